@@ -0,0 +1,86 @@
+/**
+ * @file bench_adjacency.cpp
+ * @brief Benchmark of the mutable adjacency: HashTable + LinkedList (previous) vs. vector of NeighborList.
+ *
+ * Reports build time with per-edge inserts, live heap bytes and allocations,
+ * and the time of random friendship lookups (areFriends).
+ *
+ * Uso: bench_adjacency [vertices] [aristas_por_vertice] [consultas]
+ */
+#include "bench_util.h"
+#include "bench_alloc.h"
+#include "../include/hash_table.h"
+#include "../include/neighbor_list.h"
+#include <iostream>
+#include <string>
+
+int main(int argc, char* argv[]) {
+    int n = argc >= 2 ? std::stoi(argv[1]) : 200000;
+    int m = argc >= 3 ? std::stoi(argv[2]) : 8;
+    int queries = argc >= 4 ? std::stoi(argv[3]) : 2000000;
+
+    std::vector<std::pair<int,int>> edges = syntheticEdges(n, m);
+    std::mt19937 rng(3);
+    std::vector<std::pair<int,int>> qs;
+    for (int i = 0; i < queries; ++i) {
+        if (i % 2) qs.push_back(edges[rng() % edges.size()]);            // mitad existentes
+        else qs.emplace_back(1 + rng() % n, 1 + rng() % n);
+    }
+    std::cout << "Aristas: " << edges.size() << ", consultas: " << queries << "\n";
+
+    // Anterior: tabla hash de listas enlazadas (addEdge = contains + insert)
+    HeapCounters before = heapCounters();
+    auto t0 = std::chrono::steady_clock::now();
+    HashTable* table = new HashTable(101);
+    for (const auto& e : edges) {
+        LinkedList* lu = table->get(e.first);
+        if (!lu) { lu = new LinkedList(); table->put(e.first, lu); }
+        LinkedList* lv = table->get(e.second);
+        if (!lv) { lv = new LinkedList(); table->put(e.second, lv); }
+        if (lu->contains(e.second)) continue;
+        lu->insert(e.second);
+        lv->insert(e.first);
+    }
+    double listBuild = secondsSince(t0);
+    HeapCounters after = heapCounters();
+    std::size_t listBytes = after.liveBytes - before.liveBytes, listBlocks = after.liveBlocks - before.liveBlocks;
+    long long found = 0;
+    t0 = std::chrono::steady_clock::now();
+    for (const auto& q : qs) {
+        LinkedList* l = table->get(q.first);
+        found += l && l->contains(q.second);
+    }
+    double listQuery = secondsSince(t0);
+    delete table;
+
+    // Nuevo: vector indexado por índice denso con listas ordenadas
+    before = heapCounters();
+    t0 = std::chrono::steady_clock::now();
+    std::vector<NeighborList>* adj = new std::vector<NeighborList>(n + 1);
+    for (const auto& e : edges) {
+        if (!(*adj)[e.first].insert(e.second)) continue;
+        (*adj)[e.second].insert(e.first);
+    }
+    double vecBuild = secondsSince(t0);
+    after = heapCounters();
+    std::size_t vecBytes = after.liveBytes - before.liveBytes, vecBlocks = after.liveBlocks - before.liveBlocks;
+    t0 = std::chrono::steady_clock::now();
+    for (const auto& q : qs) found -= (*adj)[q.first].contains(q.second);
+    double vecQuery = secondsSince(t0);
+    delete adj;
+
+    // Con una cabecera típica de 16 bytes por bloque del asignador
+    double listReal = listBytes + 16.0 * listBlocks, vecReal = vecBytes + 16.0 * vecBlocks;
+    std::cout << "HashTable + LinkedList:  construcción " << listBuild * 1e3 << " ms, "
+              << listBytes / (1024.0 * 1024.0) << " MiB en " << listBlocks << " bloques (~"
+              << listReal / (1024.0 * 1024.0) << " MiB reales), "
+              << "areFriends " << listQuery * 1e9 / queries << " ns\n";
+    std::cout << "vector<NeighborList>:    construcción " << vecBuild * 1e3 << " ms, "
+              << vecBytes / (1024.0 * 1024.0) << " MiB en " << vecBlocks << " bloques (~"
+              << vecReal / (1024.0 * 1024.0) << " MiB reales), "
+              << "areFriends " << vecQuery * 1e9 / queries << " ns\n";
+    std::cout << "Memoria: " << listReal / vecReal << "x menos (" << static_cast<double>(listBytes) / vecBytes
+              << "x sin cabeceras); construcción " << listBuild / vecBuild << "x, areFriends "
+              << listQuery / vecQuery << "x más rápidos  (" << found << ")\n";
+    return 0;
+}
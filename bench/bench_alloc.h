@@ -0,0 +1,67 @@
+/**
+ * @file bench_alloc.h
+ * @brief Counting replacement of global operator new/delete for the allocation benchmarks.
+ *
+ * Every block carries its size in a 16-byte header, so delete can keep live
+ * byte counts. Counters are atomic: the benchmarks also run the parallel
+ * loaders and addEdges, whose worker threads allocate too. Include this header
+ * from exactly one translation unit per executable (it defines the
+ * replacement operators).
+ */
+#ifndef BENCH_ALLOC_H
+#define BENCH_ALLOC_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+/**
+ * @struct HeapCounters
+ * @brief Snapshot of the global allocation counters; subtract two to measure a phase.
+ */
+struct HeapCounters {
+    std::size_t liveBytes;    ///< Bytes requested and not yet freed.
+    std::size_t liveBlocks;   ///< Blocks allocated and not yet freed.
+    std::size_t calls;        ///< operator new calls so far.
+    std::size_t bytes;        ///< Bytes requested so far (freed or not).
+};
+
+namespace benchAlloc {
+inline std::atomic<std::size_t> liveBytes{0}, liveBlocks{0}, calls{0}, bytes{0};
+} // namespace benchAlloc
+
+/**
+ * @brief Reads the current allocation counters.
+ * @return Counters since program start.
+ */
+inline HeapCounters heapCounters() {
+    using namespace benchAlloc;
+    return {liveBytes.load(std::memory_order_relaxed), liveBlocks.load(std::memory_order_relaxed),
+            calls.load(std::memory_order_relaxed), bytes.load(std::memory_order_relaxed)};
+}
+
+void* operator new(std::size_t n) {
+    void* p = std::malloc(n + 16);
+    if (!p) throw std::bad_alloc();
+    *static_cast<std::size_t*>(p) = n;
+    benchAlloc::liveBytes.fetch_add(n, std::memory_order_relaxed);
+    benchAlloc::liveBlocks.fetch_add(1, std::memory_order_relaxed);
+    benchAlloc::calls.fetch_add(1, std::memory_order_relaxed);
+    benchAlloc::bytes.fetch_add(n, std::memory_order_relaxed);
+    return static_cast<char*>(p) + 16;
+}
+void operator delete(void* p) noexcept {
+    if (!p) return;
+    void* base = reinterpret_cast<void*>(reinterpret_cast<std::uintptr_t>(p) - 16);
+    benchAlloc::liveBytes.fetch_sub(*static_cast<std::size_t*>(base), std::memory_order_relaxed);
+    benchAlloc::liveBlocks.fetch_sub(1, std::memory_order_relaxed);
+    std::free(base);
+}
+void operator delete(void* p, std::size_t) noexcept { operator delete(p); }
+void* operator new[](std::size_t n) { return operator new(n); }
+void operator delete[](void* p) noexcept { operator delete(p); }
+void operator delete[](void* p, std::size_t) noexcept { operator delete(p); }
+
+#endif // BENCH_ALLOC_H
@@ -0,0 +1,77 @@
+/**
+ * @file bench_bfs.cpp
+ * @brief Benchmark for full BFS traversals: hand-rolled top-down queue vs. BfsEngine (top-down only and direction-optimizing).
+ *
+ * Uso: bench_bfs [vertices] [aristas_por_vertice] [fuentes]
+ */
+#include "bench_util.h"
+#include "../include/bfs_engine.h"
+#include <iostream>
+#include <string>
+
+/**
+ * @brief Previous traversal code: sequential top-down BFS with a flat distance array.
+ */
+static uint32_t queueBfs(const CsrGraph& c, uint32_t src, std::vector<int>& dist, std::vector<uint32_t>& q) {
+    std::fill(dist.begin(), dist.end(), -1);
+    q.assign(1, src);
+    dist[src] = 0;
+    for (std::size_t h = 0; h < q.size(); ++h)
+        for (uint32_t v : c.neighbors(q[h]))
+            if (dist[v] == -1) {
+                dist[v] = dist[q[h]] + 1;
+                q.push_back(v);
+            }
+    return static_cast<uint32_t>(dist[q.back()]);
+}
+
+int main(int argc, char* argv[]) {
+    int n = argc >= 2 ? std::stoi(argv[1]) : 1000000;
+    int m = argc >= 3 ? std::stoi(argv[2]) : 16;
+    int sources = argc >= 4 ? std::stoi(argv[3]) : 16;
+
+    Graph g;
+    fillGraph(g, syntheticEdges(n, m));
+    auto csr = g.snapshot();
+    std::cout << "Grafo sintético: " << g.numVertices() << " vértices, "
+              << g.numEdges() << " aristas\n";
+
+    std::mt19937 rng(11);
+    std::vector<uint32_t> src;
+    for (int i = 0; i < sources; ++i) src.push_back(rng() % csr->numVertices());
+
+    std::vector<int> dist(csr->numVertices());
+    std::vector<uint32_t> q;
+    long long sink = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (uint32_t s : src) sink += queueBfs(*csr, s, dist, q);
+    double legacy = secondsSince(t0) / sources;
+
+    BfsEngine plain;
+    plain.setDirectionOptimizing(false);
+    t0 = std::chrono::steady_clock::now();
+    for (uint32_t s : src) sink += plain.run(*csr, s);
+    double topDown = secondsSince(t0) / sources;
+
+    BfsEngine engine;
+    uint64_t bottomUp = 0;
+    t0 = std::chrono::steady_clock::now();
+    for (uint32_t s : src) {
+        sink += engine.run(*csr, s);
+        bottomUp += engine.lastBottomUpSteps();
+    }
+    double hybrid = secondsSince(t0) / sources;
+
+    t0 = std::chrono::steady_clock::now();
+    sink += csr->componentCount();
+    double comps = secondsSince(t0);
+
+    std::cout << "BFS con cola (anterior):          " << legacy * 1e3 << " ms/fuente\n";
+    std::cout << "BfsEngine solo top-down:          " << topDown * 1e3 << " ms/fuente\n";
+    std::cout << "BfsEngine top-down/bottom-up:     " << hybrid * 1e3 << " ms/fuente, "
+              << static_cast<double>(bottomUp) / sources << " pasos bottom-up\n";
+    std::cout << "componentCount:                   " << comps * 1e3 << " ms\n";
+    std::cout << "Aceleración vs cola: " << (hybrid > 0 ? legacy / hybrid : 0.0)
+              << "x  (" << sink << ")\n";
+    return 0;
+}
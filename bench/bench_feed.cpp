@@ -0,0 +1,66 @@
+/**
+ * @file bench_feed.cpp
+ * @brief Before/after benchmark of the feed: full scan per friend + sort vs. one merged page.
+ *
+ * The previous getFeed scanned the global post vector once for the user and
+ * once per friend, copied every match and left the sorting to the caller.
+ * The feed engine merges the per-author lists and stops after one page, so
+ * its time should stay flat as the total number of posts grows.
+ *
+ * Uso: bench_feed [vertices] [tamaño_de_página]
+ */
+#include "bench_util.h"
+#include <algorithm>
+#include <iostream>
+#include <string>
+
+/**
+ * @brief Previous feed algorithm over a flat post vector, kept as the baseline.
+ */
+static std::vector<Post> legacyFeed(const Graph& g, const std::vector<Post>& posts, uint64_t userId) {
+    std::vector<Post> feed;
+    for (const auto& p : posts)
+        if (p.userId == userId) feed.push_back(p);
+    for (uint64_t f : g.neighbors(userId))
+        for (const auto& p : posts)
+            if (p.userId == f) feed.push_back(p);
+    std::sort(feed.begin(), feed.end(), [](const Post& a, const Post& b) { return a.timestamp > b.timestamp; });
+    return feed;
+}
+
+int main(int argc, char* argv[]) {
+    int n = argc >= 2 ? std::stoi(argv[1]) : 10000;
+    std::size_t pageSize = argc >= 3 ? std::stoul(argv[2]) : 20;
+
+    Graph g;
+    fillGraph(g, syntheticEdges(n, 8));
+    int user = 1;                                   // el primer vértice es un hub
+    std::cout << "Grafo sintético: " << g.numVertices() << " vértices; el usuario "
+              << user << " tiene " << g.degree(user) << " amigos, página de " << pageSize << "\n";
+
+    std::mt19937 rng(5);
+    std::vector<Post> flat;
+    std::size_t total = 0;
+    for (std::size_t target : {10000, 100000, 1000000}) {
+        for (; total < target; ++total) {
+            uint64_t author = 1 + rng() % n;
+            uint64_t id = g.addPost(author, "post");
+            flat.push_back(*g.getPost(id));
+        }
+
+        int reps = static_cast<int>(std::max<std::size_t>(1, 1000000 / total));
+        auto t0 = std::chrono::steady_clock::now();
+        std::size_t sink = 0;
+        for (int r = 0; r < reps; ++r) sink += legacyFeed(g, flat, user).size();
+        double before = secondsSince(t0) / reps;
+
+        t0 = std::chrono::steady_clock::now();
+        int pages = 2000;
+        for (int r = 0; r < pages; ++r) sink += g.feedPage(user, pageSize).posts.size();
+        double after = secondsSince(t0) / pages;
+
+        std::cout << total << " posts:  escaneo + orden " << before * 1e3 << " ms,  página fusionada "
+                  << after * 1e6 << " µs  (" << before / after << "x, " << sink << ")\n";
+    }
+    return 0;
+}
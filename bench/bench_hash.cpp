@@ -0,0 +1,109 @@
+/**
+ * @file bench_hash.cpp
+ * @brief Microbenchmark of HashTable (SIMD control bytes) against the previous digit-hash table.
+ *
+ * Uso: bench_hash [exponente_max]   (mide 10^4 .. 10^exponente_max claves, por defecto 7)
+ */
+#include "bench_util.h"
+#include "../include/hash_table.h"
+#include <climits>
+#include <iostream>
+#include <string>
+
+/**
+ * @class LegacyHashTable
+ * @brief Previous HashTable implementation, kept here as the benchmark baseline.
+ *
+ * Base-37 hash over decimal digits, odd capacity, linear probing with % capacity.
+ */
+class LegacyHashTable {
+    int* keys;
+    LinkedList** values;
+    bool* used;
+    int capacity;
+    int sz;
+    float maxLoad;
+    static const int EMPTY = INT_MIN;
+
+    int hash(int key) const {
+        long long h = 0;
+        int k = key;
+        while (k > 0) { h = h * 37 + k % 10; k /= 10; }
+        if (h < 0) h = -h;
+        return static_cast<int>(h % capacity);
+    }
+    int probe(int key) const {
+        int idx = hash(key);
+        while (used[idx] && keys[idx] != key) idx = (idx + 1) % capacity;
+        return idx;
+    }
+    void init(int cap) {
+        capacity = cap;
+        keys = new int[capacity];
+        values = new LinkedList*[capacity];
+        used = new bool[capacity];
+        for (int i = 0; i < capacity; ++i) { keys[i] = EMPTY; values[i] = nullptr; used[i] = false; }
+    }
+    void rehash() {
+        int oldCap = capacity;
+        int* oldKeys = keys; LinkedList** oldVals = values; bool* oldUsed = used;
+        init(capacity * 2 + 1);
+        sz = 0;
+        for (int i = 0; i < oldCap; ++i) if (oldUsed[i]) put(oldKeys[i], oldVals[i]);
+        delete[] oldKeys; delete[] oldVals; delete[] oldUsed;
+    }
+public:
+    explicit LegacyHashTable(int cap = 101, float load = 0.7f) : sz(0), maxLoad(load) { init(cap); }
+    ~LegacyHashTable() { delete[] keys; delete[] values; delete[] used; }
+    LinkedList* get(int key) const { int idx = probe(key); return used[idx] ? values[idx] : nullptr; }
+    void put(int key, LinkedList* value) {
+        int idx = probe(key);
+        if (!used[idx]) {
+            keys[idx] = key; used[idx] = true; values[idx] = value; ++sz;
+            if (static_cast<float>(sz) / capacity > maxLoad) rehash();
+        } else {
+            values[idx] = value;
+        }
+    }
+    bool containsKey(int key) const { return used[probe(key)]; }
+};
+
+/**
+ * @brief Times put, successful lookups and failed lookups for n sequential keys.
+ * @tparam Table Table type with put/containsKey.
+ * @param n Number of keys.
+ * @param putS Output: seconds spent inserting.
+ * @param hitS Output: seconds spent on present keys.
+ * @param missS Output: seconds spent on absent keys.
+ */
+template<class Table>
+static void run(int n, double& putS, double& hitS, double& missS) {
+    Table t;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 1; i <= n; ++i) t.put(i, nullptr);
+    putS = secondsSince(t0);
+
+    size_t found = 0;
+    t0 = std::chrono::steady_clock::now();
+    for (int i = 1; i <= n; ++i) found += t.containsKey(i);
+    hitS = secondsSince(t0);
+
+    t0 = std::chrono::steady_clock::now();
+    for (int i = 1; i <= n; ++i) found += t.containsKey(-i);
+    missS = secondsSince(t0);
+    if (found != static_cast<size_t>(n)) std::cerr << "resultado inesperado\n";
+}
+
+int main(int argc, char* argv[]) {
+    int maxExp = argc >= 2 ? std::stoi(argv[1]) : 7;
+    std::cout << "claves      tabla     put ns/op   get ns/op   miss ns/op\n";
+    int n = 10000;
+    for (int e = 4; e <= maxExp; ++e, n *= 10) {
+        double p, h, m;
+        run<LegacyHashTable>(n, p, h, m);
+        std::cout << n << "\tanterior\t" << p * 1e9 / n << "\t" << h * 1e9 / n << "\t" << m * 1e9 / n << "\n";
+        run<HashTable>(n, p, h, m);
+        std::cout << n << "\tSIMD    \t" << p * 1e9 / n << "\t" << h * 1e9 / n << "\t" << m * 1e9 / n << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,78 @@
+/**
+ * @file bench_intersect.cpp
+ * @brief Microbenchmark of the sorted-set intersection kernels over balanced and skewed inputs.
+ *
+ * Uso: bench_intersect [repeticiones_escala]
+ */
+#include "bench_util.h"
+#include "../include/intersect.h"
+#include <algorithm>
+#include <cstdio>
+#include <string>
+
+/// Genera n valores distintos y ordenados en [0, range).
+static std::vector<uint32_t> sortedSet(std::mt19937& rng, std::size_t n, uint32_t range) {
+    std::vector<uint32_t> v;
+    v.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) v.push_back(rng() % range);
+    std::sort(v.begin(), v.end());
+    v.erase(std::unique(v.begin(), v.end()), v.end());
+    return v;
+}
+
+using CountKernel = std::size_t (*)(const uint32_t*, std::size_t, const uint32_t*, std::size_t);
+using WriteKernel = std::size_t (*)(const uint32_t*, std::size_t, const uint32_t*, std::size_t, uint32_t*);
+
+/**
+ * @brief Times a count kernel and returns nanoseconds per call.
+ */
+static double timeCount(CountKernel k, const std::vector<uint32_t>& a, const std::vector<uint32_t>& b,
+                        int reps, std::size_t& sink) {
+    auto t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < reps; ++r) sink += k(a.data(), a.size(), b.data(), b.size());
+    return secondsSince(t0) * 1e9 / reps;
+}
+
+/**
+ * @brief Times a materializing kernel and returns nanoseconds per call.
+ */
+static double timeWrite(WriteKernel k, const std::vector<uint32_t>& a, const std::vector<uint32_t>& b,
+                        std::vector<uint32_t>& out, int reps, std::size_t& sink) {
+    auto t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < reps; ++r) sink += k(a.data(), a.size(), b.data(), b.size(), out.data());
+    return secondsSince(t0) * 1e9 / reps;
+}
+
+int main(int argc, char* argv[]) {
+    double scale = argc >= 2 ? std::stod(argv[1]) : 1.0;
+    std::printf("AVX2 disponible: %s\n\n", intersectHasAvx2() ? "sí" : "no (se usa la mezcla escalar)");
+
+    struct Case { const char* name; std::size_t na, nb; uint32_t range; };
+    const Case cases[] = {
+        {"balanceado disperso 1k/1k",      1000,    1000,  100000},
+        {"balanceado denso 1k/1k",         1000,    1000,    2000},
+        {"balanceado grande 100k/100k",  100000,  100000, 1000000},
+        {"sesgado 64/100k",                  64,  100000, 1000000},
+        {"muy sesgado 8/1M",                  8, 1000000, 4000000},
+    };
+
+    std::mt19937 rng(1);
+    std::size_t sink = 0;
+    std::printf("%-30s %12s %12s %12s %12s %12s\n", "caso (ns/llamada)", "escalar", "galope",
+                "avx2", "auto", "auto+escr.");
+    for (const Case& c : cases) {
+        std::vector<uint32_t> a = sortedSet(rng, c.na, c.range);
+        std::vector<uint32_t> b = sortedSet(rng, c.nb, c.range);
+        std::vector<uint32_t> out(std::min(a.size(), b.size()));
+        // Repeticiones para ~5·10^7 elementos recorridos por kernel
+        int reps = std::max(1, static_cast<int>(scale * 5e7 / (a.size() + b.size())));
+        double s = timeCount(intersectCountScalar, a, b, reps, sink);
+        double gl = timeCount(intersectCountGalloping, a, b, reps, sink);
+        double v = timeCount(intersectCountAvx2, a, b, reps, sink);
+        double d = timeCount(intersectCount, a, b, reps, sink);
+        double w = timeWrite(intersect, a, b, out, reps, sink);
+        std::printf("%-30s %12.0f %12.0f %12.0f %12.0f %12.0f\n", c.name, s, gl, v, d, w);
+    }
+    std::printf("\n(%zu)\n", sink);
+    return 0;
+}
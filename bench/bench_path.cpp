@@ -0,0 +1,112 @@
+/**
+ * @file bench_path.cpp
+ * @brief Benchmark for point-to-point shortest paths: one-sided BFS vs. bidirectional PathFinder.
+ *
+ * Uso: bench_path [vertices] [aristas_por_vertice] [pares]
+ */
+#include "bench_util.h"
+#include "../include/path_finder.h"
+#include <iostream>
+#include <queue>
+#include <string>
+#include <unordered_map>
+
+/**
+ * @brief Previous Graph::shortestPath: one-sided BFS with a hash-map distance table.
+ */
+static int legacyShortestPath(const Graph& g, uint64_t src, uint64_t dst) {
+    if (src == dst) return 0;
+    std::unordered_map<uint64_t, int> dist;
+    std::queue<uint64_t> q;
+    dist[src] = 0;
+    q.push(src);
+    while (!q.empty()) {
+        uint64_t u = q.front(); q.pop();
+        for (uint64_t v : g.neighbors(u)) {
+            if (dist.count(v)) continue;
+            dist[v] = dist[u] + 1;
+            if (v == dst) return dist[v];
+            q.push(v);
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief One-sided BFS over the CSR snapshot with a flat distance array.
+ */
+static int flatShortestPath(const CsrGraph& c, uint32_t src, uint32_t dst,
+                            std::vector<int>& dist, std::vector<uint32_t>& q, std::size_t& visited) {
+    if (src == dst) return 0;
+    std::fill(dist.begin(), dist.end(), -1);
+    q.clear();
+    dist[src] = 0;
+    q.push_back(src);
+    for (std::size_t h = 0; h < q.size(); ++h) {
+        uint32_t u = q[h];
+        for (uint32_t v : c.neighbors(u)) {
+            if (dist[v] != -1) continue;
+            dist[v] = dist[u] + 1;
+            ++visited;
+            if (v == dst) return dist[v];
+            q.push_back(v);
+        }
+    }
+    return -1;
+}
+
+int main(int argc, char* argv[]) {
+    int n = argc >= 2 ? std::stoi(argv[1]) : 200000;
+    int m = argc >= 3 ? std::stoi(argv[2]) : 8;
+    int pairs = argc >= 4 ? std::stoi(argv[3]) : 200;
+
+    Graph g;
+    fillGraph(g, syntheticEdges(n, m));
+    auto csr = g.snapshot();
+    std::cout << "Grafo sintético: " << g.numVertices() << " vértices, "
+              << g.numEdges() << " aristas\n";
+
+    std::mt19937 rng(7);
+    std::vector<std::pair<uint32_t, uint32_t>> qs;
+    for (int i = 0; i < pairs; ++i)
+        qs.emplace_back(rng() % csr->numVertices(), rng() % csr->numVertices());
+
+    // Línea base original (limitada: es muy lenta en grafos grandes)
+    int legacyPairs = std::min(pairs, 20);
+    auto t0 = std::chrono::steady_clock::now();
+    long long sink = 0;
+    for (int i = 0; i < legacyPairs; ++i)
+        sink += legacyShortestPath(g, g.idMap().external(qs[i].first), g.idMap().external(qs[i].second));
+    double legacy = secondsSince(t0) / legacyPairs;
+
+    std::vector<int> dist(csr->numVertices());
+    std::vector<uint32_t> q;
+    std::size_t flatVisited = 0;
+    t0 = std::chrono::steady_clock::now();
+    for (auto& p : qs) sink += flatShortestPath(*csr, p.first, p.second, dist, q, flatVisited);
+    double flat = secondsSince(t0) / pairs;
+
+    PathFinder finder;
+    std::size_t biVisited = 0;
+    t0 = std::chrono::steady_clock::now();
+    for (auto& p : qs) {
+        sink += finder.distance(*csr, p.first, p.second);
+        biVisited += finder.lastVisited();
+    }
+    double bi = secondsSince(t0) / pairs;
+
+    t0 = std::chrono::steady_clock::now();
+    for (auto& p : qs) sink += static_cast<long long>(finder.path(*csr, p.first, p.second).size());
+    double route = secondsSince(t0) / pairs;
+
+    std::cout << "BFS con unordered_map (original): " << legacy * 1e3 << " ms/par\n";
+    std::cout << "BFS unidireccional sobre CSR:     " << flat * 1e3 << " ms/par, "
+              << flatVisited / pairs << " vértices visitados\n";
+    std::cout << "BFS bidireccional:                " << bi * 1e3 << " ms/par, "
+              << biVisited / pairs << " vértices visitados\n";
+    std::cout << "BFS bidireccional + ruta:         " << route * 1e3 << " ms/par\n";
+    std::cout << "Aceleración vs original: " << (bi > 0 ? legacy / bi : 0.0)
+              << "x, vs CSR unidireccional: " << (bi > 0 ? flat / bi : 0.0)
+              << "x  (" << sink << ")\n";
+    return 0;
+}
@@ -0,0 +1,104 @@
+/**
+ * @file bench_posts.cpp
+ * @brief Benchmark of post storage: one std::string and comment vector per post (previous) vs. arenas.
+ *
+ * Writes the same stream of posts and comments (lengths typical of a social
+ * network, mostly beyond the small-string buffer) into the previous layout
+ * and into PostStore, and reports write time, allocator calls and live heap
+ * bytes per post. Allocator calls are what threads fight over on a
+ * write-heavy load, so they are the figure to watch besides memory.
+ *
+ * Uso: bench_posts [posts] [comentarios_por_post]
+ */
+#include "bench_util.h"
+#include "bench_alloc.h"
+#include "../include/post_store.h"
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+/**
+ * @brief Post layout before the arenas, kept as the baseline.
+ */
+struct LegacyPost {
+    uint64_t id = 0;
+    uint64_t userId;
+    std::string text;
+    std::time_t timestamp;
+    int likes = 0;
+    std::vector<std::pair<std::string, std::time_t>> comments;
+};
+
+int main(int argc, char* argv[]) {
+    int n = argc >= 2 ? std::stoi(argv[1]) : 500000;
+    double perPost = argc >= 3 ? std::stod(argv[2]) : 2.0;
+
+    // Flujo de escritura: (post o comentario, longitud); se genera antes de medir
+    std::mt19937 rng(11);
+    std::uniform_int_distribution<int> postLen(20, 280), commentLen(5, 120);
+    std::bernoulli_distribution comment(perPost / (perPost + 1));
+    struct Op { bool comment; uint32_t target; uint16_t len; };
+    std::vector<Op> ops;
+    int posts = 0;
+    while (posts < n) {
+        if (posts > 0 && comment(rng))
+            ops.push_back({true, static_cast<uint32_t>(rng() % posts), static_cast<uint16_t>(commentLen(rng))});
+        else
+            ops.push_back({false, static_cast<uint32_t>(posts++), static_cast<uint16_t>(postLen(rng))});
+    }
+    const std::string text(400, 'a');
+    std::size_t comments = ops.size() - n;
+    std::cout << n << " posts, " << comments << " comentarios\n";
+
+    // Anterior: un std::string por post y un vector de pares por post con comentarios
+    HeapCounters before = heapCounters();
+    auto t0 = std::chrono::steady_clock::now();
+    std::vector<LegacyPost>* legacy = new std::vector<LegacyPost>();
+    for (const Op& op : ops) {
+        if (op.comment) {
+            (*legacy)[op.target].comments.emplace_back(text.substr(0, op.len), 0);
+        } else {
+            LegacyPost p;
+            p.id = legacy->size() + 1;
+            p.userId = op.target % 1000;
+            p.text = text.substr(0, op.len);
+            p.timestamp = 0;
+            legacy->push_back(std::move(p));
+        }
+    }
+    double legacyTime = secondsSince(t0);
+    HeapCounters after = heapCounters();
+    std::size_t legacyBytes = after.liveBytes - before.liveBytes, legacyCalls = after.calls - before.calls,
+                legacyBlocks = after.liveBlocks - before.liveBlocks;
+    delete legacy;
+
+    // Nuevo: registros fijos y texto en arenas
+    before = heapCounters();
+    t0 = std::chrono::steady_clock::now();
+    PostStore* store = new PostStore();
+    std::string_view all(text);
+    for (const Op& op : ops) {
+        if (op.comment) store->addComment(op.target + 1, all.substr(0, op.len), 0);
+        else store->add(op.target % 1000, all.substr(0, op.len), 0);
+    }
+    double storeTime = secondsSince(t0);
+    after = heapCounters();
+    std::size_t storeBytes = after.liveBytes - before.liveBytes, storeCalls = after.calls - before.calls,
+                storeBlocks = after.liveBlocks - before.liveBlocks;
+    PostStoreStats st = store->stats();
+    delete store;
+
+    // Con una cabecera típica de 16 bytes por bloque del asignador
+    double legacyReal = legacyBytes + 16.0 * legacyBlocks, storeReal = storeBytes + 16.0 * storeBlocks;
+    std::cout << "string + vector<pair>:  escritura " << legacyTime * 1e9 / ops.size() << " ns/op, "
+              << static_cast<double>(legacyCalls) / ops.size() << " llamadas al asignador/op, "
+              << legacyReal / n << " bytes/post\n";
+    std::cout << "PostStore (arenas):     escritura " << storeTime * 1e9 / ops.size() << " ns/op, "
+              << static_cast<double>(storeCalls) / ops.size() << " llamadas al asignador/op, "
+              << storeReal / n << " bytes/post (informe: " << st.bytesPerPost() << ", texto "
+              << static_cast<double>(st.textBytes) / n << ")\n";
+    std::cout << "Memoria: " << legacyReal / storeReal << "x menos; asignaciones: "
+              << static_cast<double>(legacyCalls) / storeCalls << "x menos; escritura "
+              << legacyTime / storeTime << "x más rápida\n";
+    return 0;
+}
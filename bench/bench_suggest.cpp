@@ -0,0 +1,82 @@
+/**
+ * @file bench_suggest.cpp
+ * @brief Before/after benchmark for Suggester::suggest: one shortestPath per candidate vs. a single bounded BFS.
+ *
+ * Uso: bench_suggest [vertices] [aristas_por_vertice] [consultas]
+ */
+#include "bench_util.h"
+#include "../include/suggester.h"
+#include "../include/avl_tree.h"
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+/**
+ * @brief Previous suggestion algorithm, kept here as the benchmark baseline.
+ *
+ * Calls Graph::shortestPath for every friend-of-friend edge and again for every
+ * candidate while filling the AVL tree.
+ */
+static std::vector<int> legacySuggest(const Graph& g, const Suggester& s,
+                                      int u, int k, int radius) {
+    FriendRange neigh = g.neighbors(u);
+    if (neigh.empty()) return {};
+    std::unordered_set<int> already;
+    already.insert(u);
+    for (uint64_t f : neigh) already.insert(static_cast<int>(f));
+
+    std::unordered_map<int,int> mutualCnt;
+    for (uint64_t f : neigh) {
+        for (uint64_t w : g.neighbors(f)) {
+            int v = static_cast<int>(w);
+            if (already.count(v)) continue;
+            int d = g.shortestPath(u, v);
+            if (d == -1 || d > radius) continue;
+            ++mutualCnt[v];
+        }
+    }
+    AVLTree tree;
+    for (auto& [cand, mutCnt] : mutualCnt) {
+        int d = g.shortestPath(u, cand);
+        tree.insert(cand, 2 * mutCnt + s.commonTags(u, cand) - d);
+    }
+    return tree.topK(k);
+}
+
+int main(int argc, char* argv[]) {
+    int n = argc >= 2 ? std::stoi(argv[1]) : 5000;
+    int m = argc >= 3 ? std::stoi(argv[2]) : 8;
+    int queries = argc >= 4 ? std::stoi(argv[3]) : 20;
+
+    Graph g;
+    fillGraph(g, syntheticEdges(n, m));
+    Suggester s(&g);
+    std::cout << "Grafo sintético: " << g.numVertices() << " vértices, "
+              << g.numEdges() << " aristas\n";
+
+    // Consultas sobre los vértices de mayor grado (peor caso)
+    std::vector<int> ids;
+    for (int v = 1; v <= n; ++v) ids.push_back(v);
+    std::partial_sort(ids.begin(), ids.begin() + std::min(queries, n), ids.end(),
+                      [&](int a, int b) { return g.degree(a) > g.degree(b); });
+    ids.resize(std::min(queries, n));
+
+    auto t0 = std::chrono::steady_clock::now();
+    size_t sink = 0;
+    for (int u : ids) sink += legacySuggest(g, s, u, 5, 2).size();
+    double before = secondsSince(t0);
+
+    t0 = std::chrono::steady_clock::now();
+    for (int u : ids) sink += s.suggest(u, 5, 2).size();
+    double after = secondsSince(t0);
+
+    std::cout << "Antes  (shortestPath por candidato): "
+              << before * 1e3 / ids.size() << " ms/consulta\n";
+    std::cout << "Después (un BFS acotado):            "
+              << after * 1e3 / ids.size() << " ms/consulta\n";
+    std::cout << "Aceleración: " << (after > 0 ? before / after : 0.0)
+              << "x  (" << sink << ")\n";
+    return 0;
+}
@@ -0,0 +1,80 @@
+/**
+ * @file bench_timeline.cpp
+ * @brief Read/write cost of feeds: pull (k-way merge) vs. fan-out on write, pure and hybrid.
+ *
+ * Users have synthetic friendships and each follows F others, chosen either
+ * uniformly or with a Zipf law (a few accounts gather most followers). For
+ * each distribution the same post stream is written and the same random
+ * readers fetch a first page, with: no cache (pull), a cache that fans out
+ * every post (pure push) and a cache that leaves celebrities to the pull
+ * path (hybrid). Every reader reads once before the posts so its ring exists.
+ *
+ * Uso: bench_timeline [usuarios] [posts] [seguidos_por_usuario] [umbral_celebridad]
+ */
+#include "bench_util.h"
+#include "../include/timeline_cache.h"
+#include <cmath>
+#include <iostream>
+#include <string>
+
+/**
+ * @brief Builds the social graph: friendships plus F follows per user.
+ */
+static void build(Graph& g, int n, int follows, bool zipf, unsigned seed) {
+    fillGraph(g, syntheticEdges(n, 4, seed));
+    std::mt19937 rng(seed);
+    std::vector<double> cdf(n);
+    double acc = 0;
+    for (int i = 0; i < n; ++i) cdf[i] = acc += zipf ? 1.0 / std::pow(i + 1, 1.1) : 1.0;
+    std::uniform_real_distribution<double> u(0, acc);
+    for (int v = 1; v <= n; ++v)
+        for (int i = 0; i < follows; ++i) {
+            int target = 1 + static_cast<int>(std::lower_bound(cdf.begin(), cdf.end(), u(rng)) - cdf.begin());
+            g.follow(v, std::min(target, n));
+        }
+}
+
+int main(int argc, char* argv[]) {
+    int n = argc >= 2 ? std::stoi(argv[1]) : 20000;
+    int postCount = argc >= 3 ? std::stoi(argv[2]) : 100000;
+    int follows = argc >= 4 ? std::stoi(argv[3]) : 20;
+    std::size_t threshold = argc >= 5 ? std::stoul(argv[4]) : 1000;
+    const std::size_t PAGE = 20;
+    const int READS = 20000;
+
+    for (bool zipf : {false, true}) {
+        std::cout << (zipf ? "Seguidores Zipf(1.1)" : "Seguidores uniformes") << ", " << n << " usuarios, "
+                  << postCount << " posts, página de " << PAGE << "\n";
+        for (int mode = 0; mode < 3; ++mode) {
+            Graph g;
+            build(g, n, follows, zipf, 7);
+            if (mode > 0) {
+                TimelineConfig cfg;
+                cfg.celebrityThreshold = mode == 1 ? static_cast<std::size_t>(-1) : threshold;
+                g.enableTimelineCache(cfg);
+                for (int v = 1; v <= n; ++v) g.feedPage(v, 1);      // crea los anillos
+            }
+
+            std::mt19937 rng(3);
+            auto t0 = std::chrono::steady_clock::now();
+            for (int i = 0; i < postCount; ++i) g.addPost(1 + rng() % n, "post");
+            double write = secondsSince(t0) / postCount;
+
+            t0 = std::chrono::steady_clock::now();
+            std::size_t sink = 0;
+            for (int i = 0; i < READS; ++i) sink += g.feedPage(1 + rng() % n, PAGE).posts.size();
+            double read = secondsSince(t0) / READS;
+
+            const char* name[] = {"pull          ", "push puro     ", "híbrido       "};
+            std::cout << "  " << name[mode] << " escritura " << write * 1e6 << " µs/post, lectura "
+                      << read * 1e6 << " µs/página";
+            if (const TimelineCache* c = g.timelineCache()) {
+                const TimelineStats& st = c->stats();
+                std::cout << ", " << static_cast<double>(st.pushes) / postCount << " copias/post, "
+                          << st.pulledPosts << " posts por pull, " << st.bytes / (1024.0 * 1024.0) << " MiB";
+            }
+            std::cout << "  (" << sink << ")\n";
+        }
+    }
+    return 0;
+}
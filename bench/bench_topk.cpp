@@ -0,0 +1,70 @@
+/**
+ * @file bench_topk.cpp
+ * @brief Benchmark of top-k selection: AVLTree (previous suggest path) vs. TopK, serial and merged per thread.
+ *
+ * For 10^3..10^6 candidates with random scores (many ties), reports the time
+ * per candidate of inserting everything into an arena-backed AVLTree and
+ * reading topK(k), of a single TopK, and of one TopK per parallelFor chunk
+ * merged at the end.
+ *
+ * Uso: bench_topk [k]
+ */
+#include "bench_util.h"
+#include "../include/avl_tree.h"
+#include "../include/parallel.h"
+#include "../include/top_k.h"
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <string>
+
+int main(int argc, char* argv[]) {
+    int k = argc >= 2 ? std::stoi(argv[1]) : 5;
+    unsigned threads = workerCount();
+    std::cout << "k = " << k << ", hilos = " << threads << "\n";
+
+    std::mt19937 rng(11);
+    Arena scratch;
+    for (int n = 1000; n <= 1000000; n *= 10) {
+        std::vector<int> score(n);
+        for (int& s : score) s = static_cast<int>(rng() % (n / 10 + 1));
+        int reps = std::max(1, 2000000 / n);
+        std::vector<uint32_t> ref, got, par;
+
+        auto t0 = std::chrono::steady_clock::now();
+        for (int r = 0; r < reps; ++r) {
+            AVLTree tree(scratch);
+            for (int v = 0; v < n; ++v) tree.insert(v, score[v]);
+            std::vector<int> top = tree.topK(k);
+            ref.assign(top.begin(), top.end());
+        }
+        double avl = secondsSince(t0) / reps;
+
+        t0 = std::chrono::steady_clock::now();
+        for (int r = 0; r < reps; ++r) {
+            TopK<int> best(k);
+            for (int v = 0; v < n; ++v) best.offer(score[v], static_cast<uint32_t>(v));
+            got = best.keys();
+        }
+        double heap = secondsSince(t0) / reps;
+
+        t0 = std::chrono::steady_clock::now();
+        for (int r = 0; r < reps; ++r) {
+            std::vector<TopK<int>> parts(threads, TopK<int>(k));
+            parallelFor(n, [&](std::size_t b, std::size_t e, unsigned chunk) {
+                TopK<int>& mine = parts[chunk];
+                for (std::size_t v = b; v < e; ++v) mine.offer(score[v], static_cast<uint32_t>(v));
+            }, threads);
+            TopK<int> best(k);
+            for (const TopK<int>& p : parts) best.merge(p);
+            par = best.keys();
+        }
+        double merged = secondsSince(t0) / reps;
+
+        assert(got == ref && par == ref);
+        std::cout << "n = " << n << ":  AVLTree " << avl * 1e9 / n << " ns/cand,  TopK "
+                  << heap * 1e9 / n << " ns/cand (" << avl / heap << "x),  TopK por hilo + merge "
+                  << merged * 1e9 / n << " ns/cand (" << avl / merged << "x)\n";
+    }
+    return 0;
+}
@@ -0,0 +1,64 @@
+/**
+ * @file bench_util.h
+ * @brief Shared helpers for the benchmark executables: timing and synthetic graphs.
+ */
+#ifndef BENCH_UTIL_H
+#define BENCH_UTIL_H
+
+#include "../include/graph.h"
+#include <chrono>
+#include <random>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Returns the seconds elapsed since a reference time point.
+ * @param t0 Reference time point.
+ * @return Elapsed wall-clock seconds.
+ */
+inline double secondsSince(std::chrono::steady_clock::time_point t0) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+}
+
+/**
+ * @brief Generates a small-world edge list with preferential attachment.
+ *
+ * Each new vertex links to m existing vertices, chosen proportionally to their
+ * degree, which produces the high-degree hubs typical of social graphs.
+ * @param n Number of vertices (IDs 1..n).
+ * @param m Edges added per new vertex.
+ * @param seed Random seed.
+ * @return List of undirected edges (u, v).
+ */
+inline std::vector<std::pair<int,int>> syntheticEdges(int n, int m, unsigned seed = 42) {
+    std::mt19937 rng(seed);
+    std::vector<std::pair<int,int>> edges;
+    std::vector<int> endpoints;         // cada vértice aparece deg veces
+    edges.reserve(static_cast<size_t>(n) * m);
+    for (int v = 2; v <= n; ++v) {
+        int links = std::min(m, v - 1);
+        for (int i = 0; i < links; ++i) {
+            int u;
+            if (endpoints.empty() || rng() % 4 == 0) {
+                u = 1 + static_cast<int>(rng() % (v - 1));
+            } else {
+                u = endpoints[rng() % endpoints.size()];
+            }
+            edges.emplace_back(u, v);
+            endpoints.push_back(u);
+            endpoints.push_back(v);
+        }
+    }
+    return edges;
+}
+
+/**
+ * @brief Builds a Graph from a synthetic edge list.
+ * @param g Graph to fill.
+ * @param edges Edge list from syntheticEdges().
+ */
+inline void fillGraph(Graph& g, const std::vector<std::pair<int,int>>& edges) {
+    for (const auto& e : edges) g.addEdge(e.first, e.second);
+}
+
+#endif // BENCH_UTIL_H
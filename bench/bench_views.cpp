@@ -0,0 +1,87 @@
+/**
+ * @file bench_views.cpp
+ * @brief Heap allocations and time per feed refresh: copies (getFeed, mergeFeed, feedPage) vs. in-place views.
+ *
+ * Every user has synthetic friendships and follows F others; posts are spread
+ * over random authors. Each variant refreshes the first page of the same
+ * random readers:
+ *  - getFeed: copies the reader's whole feed as std::vector<Post>;
+ *  - mergeFeed: one page of IDs, with fresh merge buffers on every call;
+ *  - feedPage: one page of IDs, merged in local buffers (thread-safe without the cache);
+ *  - forEachFeedPost: visits the page in place, no copies.
+ * The follower lists are compared the same way (getFollowers vs. followersOf).
+ *
+ * Uso: bench_views [usuarios] [posts] [seguidos_por_usuario]
+ */
+#include "bench_util.h"
+#include "bench_alloc.h"
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+/**
+ * @brief Runs a refresh over the sample readers and prints allocations and time per refresh.
+ * @param name Label of the variant.
+ * @param readers Sample of reader IDs.
+ * @param refresh Callable refresh(reader) returning a checksum.
+ */
+template <class Fn>
+static void measure(const char* name, const std::vector<uint64_t>& readers, Fn refresh) {
+    std::size_t sink = 0;
+    for (std::size_t i = 0; i < readers.size() && i < 100; ++i) sink += refresh(readers[i]);   // calienta buffers
+    HeapCounters before = heapCounters();
+    auto t0 = std::chrono::steady_clock::now();
+    for (uint64_t r : readers) sink += refresh(r);
+    double secs = secondsSince(t0);
+    HeapCounters after = heapCounters();
+    double n = static_cast<double>(readers.size());
+    std::cout << "  " << name << (after.calls - before.calls) / n << " asignaciones, " << (after.bytes - before.bytes) / n << " bytes, "
+              << secs / n * 1e6 << " µs por refresco  (" << sink << ")\n";
+}
+
+int main(int argc, char* argv[]) {
+    int n = argc >= 2 ? std::stoi(argv[1]) : 5000;
+    int postCount = argc >= 3 ? std::stoi(argv[2]) : 100000;
+    int follows = argc >= 4 ? std::stoi(argv[3]) : 20;
+    const std::size_t PAGE = 20;
+    const int READS = 2000;
+
+    Graph g;
+    fillGraph(g, syntheticEdges(n, 4, 7));
+    std::mt19937 rng(5);
+    for (int v = 1; v <= n; ++v)
+        for (int i = 0; i < follows; ++i) g.follow(v, 1 + rng() % n);
+    PostStore store;                                // copia para la variante mergeFeed (mismos IDs)
+    for (int i = 0; i < postCount; ++i) {
+        uint64_t author = 1 + rng() % n;
+        const char* text = "un post de longitud típica, sin SSO";
+        g.addPost(author, text);
+        store.add(author, text, 0);
+    }
+    std::vector<uint64_t> readers;
+    for (int i = 0; i < READS; ++i) readers.push_back(1 + rng() % n);
+
+    std::cout << n << " usuarios, " << postCount << " posts, página de " << PAGE << "\n";
+    measure("getFeed         ", readers, [&](uint64_t r) { return g.getFeed(r).size(); });
+    measure("mergeFeed       ", readers, [&](uint64_t r) {
+        std::vector<uint64_t> authors{r};                      // como la ruta anterior: autores en un vector nuevo
+        for (uint64_t f : g.neighbors(r)) authors.push_back(f);
+        for (uint64_t f : g.followingOf(r)) authors.push_back(f);
+        return mergeFeed(store, authors, PAGE).posts.size();
+    });
+    measure("feedPage        ", readers, [&](uint64_t r) {
+        std::size_t likes = 0;
+        for (uint64_t id : g.feedPage(r, PAGE).posts) likes += g.getPost(id)->likes + 1;
+        return likes;
+    });
+    measure("forEachFeedPost ", readers, [&](uint64_t r) {
+        std::size_t likes = 0;
+        g.forEachFeedPost(r, PAGE, [&](const Post& p) { likes += p.likes + 1; });
+        return likes;
+    });
+
+    std::cout << "Lista de seguidores\n";
+    measure("getFollowers    ", readers, [&](uint64_t r) { return g.getFollowers(r).size(); });
+    measure("followersOf     ", readers, [&](uint64_t r) { return g.followersOf(r).size(); });
+    return 0;
+}
@@ -37,11 +37,26 @@ private slots:
      */
     void onPost();
 
+    /**
+     * @brief Appends the next page of the feed (button "Ver más").
+     */
+    void loadMore();
+
 private:
+    /**
+     * @brief Adds one post row (text, like and comment buttons) to the list.
+     * @param p Post to display.
+     */
+    void addPostItem(const Post& p);
+
+    static const std::size_t PAGE_SIZE = 20;  ///< Posts per feed page.
+
     Graph& g;                  ///< Reference to the social graph.
     uint64_t userId;           ///< ID of the current user.
     QVBoxLayout* mainLayout;   ///< Main vertical layout.
     QTextEdit* postEdit;       ///< Text input for new post.
     QPushButton* postButton;   ///< Button to publish new post.
     QListWidget* postList;     ///< List widget showing posts.
+    QPushButton* moreButton;   ///< Button to load the next feed page.
+    uint64_t cursor = 0;       ///< Feed cursor after the last loaded page.
 };
\ No newline at end of file
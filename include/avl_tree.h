@@ -6,6 +6,8 @@
 #ifndef AVL_TREE_H
 #define AVL_TREE_H
 
+#include "pool.h"
+#include <unordered_map>
 #include <vector>
 
 /**
@@ -16,6 +18,7 @@ struct AVLNode {
     int user;    ///< Candidate user ID.
     int score;   ///< Score value (e.g., number of mutual friends).
     int height;  ///< Height of the subtree rooted at this node.
+    int size;    ///< Number of nodes in the subtree rooted at this node.
     AVLNode* left;  ///< Pointer to the left child.
     AVLNode* right; ///< Pointer to the right child.
     /**
@@ -24,46 +27,133 @@ struct AVLNode {
      * @param s Initial score for the user.
      */
     AVLNode(int u, int s)
-        : user(u), score(s), height(1), left(nullptr), right(nullptr) {}
+        : user(u), score(s), height(1), size(1), left(nullptr), right(nullptr) {}
 };
 
 /**
  * @class AVLTree
- * @brief Implements a balanced AVL tree to store user scores and retrieve the top-k highest scores.
+ * @brief Order-statistic AVL tree of (score, user) pairs: top-k, rank and score ranges in O(log n).
+ *
+ * Each user appears at most once. Entries are ordered by score, ties by user
+ * ID, and every node stores its subtree size, so rank() and range() only walk
+ * one or two root-to-leaf paths. A user → score index locates a user's node
+ * for update() and erase(), which lets the tree back a live leaderboard that
+ * is adjusted event by event instead of re-sorted.
+ *
+ * Nodes come from an Arena and are never returned to it one by one: erased
+ * nodes are kept on a free list for later inserts, and the whole tree is
+ * released at once when it goes out of scope. A tree built on a caller's
+ * arena (one per request, reused across requests) just rewinds it.
  */
 class AVLTree {
 private:
     AVLNode* root;
+    Arena own;                  // arena propia si no se pasa una externa
+    Arena* arena;               // de donde salen los nodos
+    AVLNode* freeNodes = nullptr;               // nodos borrados, enlazados por right
+    std::unordered_map<int, int> index;         // usuario → puntaje (clave de su nodo)
 
     // utilidades internas
     int h(AVLNode* n) const { return n ? n->height : 0; }
+    int sz(AVLNode* n) const { return n ? n->size : 0; }
     int balance(AVLNode* n) const { return n ? h(n->left) - h(n->right) : 0; }
+    void pull(AVLNode* n) {
+        n->height = (h(n->left) > h(n->right) ? h(n->left) : h(n->right)) + 1;
+        n->size = sz(n->left) + sz(n->right) + 1;
+    }
 
     AVLNode* rotateRight(AVLNode* y);
     AVLNode* rotateLeft(AVLNode* x);
+    AVLNode* rebalance(AVLNode* node);
 
     bool isLess(int s1, int u1, int s2, int u2) const; // orden ascendente por score, luego ID
 
+    AVLNode* newNode(int user, int score);
     AVLNode* insert(AVLNode* node, int user, int score);
+    AVLNode* erase(AVLNode* node, int user, int score);
 
     void inorderDesc(AVLNode* node, int k, int& count, std::vector<int>& out) const;
-    void destroy(AVLNode* node);
+    void rangeDesc(AVLNode* node, int lo, int hi, std::vector<int>& out) const;
 public:
     /**
-     * @brief Constructs an empty AVLTree.
+     * @brief Constructs an empty AVLTree with its own arena.
      */
     AVLTree();
     /**
-     * @brief Destroys the AVLTree and frees all nodes.
+     * @brief Constructs an empty AVLTree whose nodes live in a caller-owned arena.
+     * @param scratch Arena reset when the tree is destroyed.
+     */
+    explicit AVLTree(Arena& scratch);
+    /**
+     * @brief Destroys the AVLTree, releasing all nodes at once.
      */
     ~AVLTree();
 
+    AVLTree(const AVLTree&) = delete;
+    AVLTree& operator=(const AVLTree&) = delete;
+    /**
+     * @brief Takes over another tree's nodes (and its arena, own or shared).
+     * @param other Tree left empty.
+     */
+    AVLTree(AVLTree&& other) noexcept;
+    /**
+     * @brief Releases this tree's nodes and takes over another tree's.
+     *
+     * A shared arena is rewound first unless other lives on the same one.
+     * @param other Tree left empty.
+     * @return This tree.
+     */
+    AVLTree& operator=(AVLTree&& other) noexcept;
+
     /**
      * @brief Inserts or updates a user and its score into the AVL tree.
      * @param user The user ID.
      * @param score The score associated with the user.
      */
     void insert(int user, int score);
+    /**
+     * @brief Changes the score of a user already in the tree.
+     * @param user The user ID.
+     * @param newScore New score.
+     * @return false if the user is not in the tree.
+     */
+    bool update(int user, int newScore);
+    /**
+     * @brief Removes a user from the tree.
+     * @param user The user ID.
+     * @return false if the user is not in the tree.
+     */
+    bool erase(int user);
+    /**
+     * @brief Checks whether a user is in the tree.
+     * @param user The user ID.
+     * @return true if present.
+     */
+    bool contains(int user) const { return index.count(user) != 0; }
+    /**
+     * @brief Returns a user's current score.
+     * @param user The user ID.
+     * @return The score, or 0 if the user is not in the tree.
+     */
+    int score(int user) const;
+    /**
+     * @brief Returns a user's position from the top (1 = highest score).
+     * @param user The user ID.
+     * @return 1-based rank, or -1 if the user is not in the tree.
+     */
+    int rank(int user) const;
+    /**
+     * @brief Returns the users whose score lies in [lo, hi], highest first.
+     * @param lo Minimum score (inclusive).
+     * @param hi Maximum score (inclusive).
+     * @return User IDs sorted by score from highest to lowest.
+     */
+    std::vector<int> range(int lo, int hi) const;
+    /**
+     * @brief Returns the number of users in the tree.
+     * @return Tree size.
+     */
+    int size() const { return sz(root); }
     /**
      * @brief Returns the top k users with highest scores in descending order.
      * @param k Number of top users to retrieve.
@@ -72,4 +162,4 @@ public:
     std::vector<int> topK(int k) const;           // k mayores puntajes
 };
 
-#endif // AVL_TREE_H
\ No newline at end of file
+#endif // AVL_TREE_H
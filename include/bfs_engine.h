@@ -0,0 +1,124 @@
+/**
+ * @file bfs_engine.h
+ * @brief Defines BfsEngine, the direction-optimizing parallel BFS shared by the graph traversals.
+ */
+#ifndef BFS_ENGINE_H
+#define BFS_ENGINE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+class CsrGraph;
+
+/**
+ * @class BfsEngine
+ * @brief Level-synchronous BFS over a CsrGraph that switches between top-down and bottom-up steps.
+ *
+ * A top-down step scans the edges of the frontier and claims unvisited
+ * neighbors through an atomic visited bitmap. A bottom-up step scans the
+ * unvisited vertices instead and stops at the first neighbor found in the
+ * frontier bitmap, which is far cheaper once the frontier holds a large
+ * share of the graph. The engine switches to bottom-up when the frontier's
+ * edges exceed 1/ALPHA of the unexplored edges and back when the frontier
+ * shrinks below 1/BETA of the vertices (Beamer et al.). Both kinds of step
+ * are split across threads; small frontiers run on the calling thread.
+ *
+ * After run(), distances, parents and the visit order stay readable until
+ * the next run. Buffers are reused across runs and only the touched entries
+ * are cleared, so many short searches stay cheap.
+ */
+class BfsEngine {
+private:
+    std::vector<int> dist;                            // -1 = no alcanzado
+    std::vector<uint32_t> par;                        // predecesor en el árbol BFS
+    std::vector<uint32_t> visitOrder;                 // vértices alcanzados, nivel a nivel
+    std::vector<std::size_t> levelStart;              // inicio de cada nivel en visitOrder
+    std::unique_ptr<std::atomic<uint64_t>[]> seen;    // bitmap de visitados
+    std::vector<uint64_t> frontBits;                  // frontera en bitmap (pasos bottom-up)
+    std::vector<std::vector<uint32_t>> local;         // descubiertos por hilo en cada paso
+    uint32_t n = 0;
+    bool directionOptimizing = true;
+    uint32_t bottomUpSteps = 0;
+
+    void prepare(const CsrGraph& g);
+    uint64_t topDown(const CsrGraph& g, std::size_t b, std::size_t e, int depth, unsigned threads);
+    uint64_t bottomUp(const CsrGraph& g, int depth, unsigned threads);
+public:
+    /// Top-down → bottom-up threshold: frontier edges > unexplored edges / ALPHA.
+    static constexpr uint64_t ALPHA = 14;
+    /// Bottom-up → top-down threshold: frontier vertices < n / BETA.
+    static constexpr uint64_t BETA = 24;
+    /// Depth limit meaning "no limit".
+    static constexpr uint32_t UNLIMITED = UINT32_MAX;
+
+    /**
+     * @brief Runs a BFS from one source.
+     * @param g Graph snapshot (must stay alive while results are read).
+     * @param src Source dense index.
+     * @param maxDepth Levels to expand (vertices farther away stay unreached).
+     * @return Depth of the last level reached (the source's eccentricity when unlimited).
+     */
+    uint32_t run(const CsrGraph& g, uint32_t src, uint32_t maxDepth = UNLIMITED);
+
+    /**
+     * @brief Runs a BFS from several sources at distance 0.
+     * @param g Graph snapshot.
+     * @param sources Source dense indices (duplicates allowed).
+     * @param maxDepth Levels to expand.
+     * @return Depth of the last level reached.
+     */
+    uint32_t run(const CsrGraph& g, const std::vector<uint32_t>& sources, uint32_t maxDepth = UNLIMITED);
+
+    /**
+     * @brief Returns the distance of a vertex found by the last run.
+     * @param v Dense index.
+     * @return Hops from the nearest source, or -1 if unreached.
+     */
+    int distance(uint32_t v) const { return dist[v]; }
+
+    /**
+     * @brief Returns the BFS-tree predecessor of a reached vertex (a source is its own parent).
+     * @param v Dense index reached by the last run.
+     * @return Parent dense index.
+     */
+    uint32_t parent(uint32_t v) const { return par[v]; }
+
+    /**
+     * @brief Returns the reached vertices level by level (sources first).
+     * @return Visit order of the last run.
+     */
+    const std::vector<uint32_t>& order() const { return visitOrder; }
+
+    /**
+     * @brief Returns the number of levels reached by the last run (eccentricity + 1).
+     * @return Level count.
+     */
+    uint32_t levels() const { return static_cast<uint32_t>(levelStart.size() - 1); }
+
+    /**
+     * @brief Returns the vertices at exactly distance d in the last run.
+     * @param d Level (< levels()).
+     * @return Pointer range [first, second) into order().
+     */
+    std::pair<const uint32_t*, const uint32_t*> level(uint32_t d) const {
+        return {visitOrder.data() + levelStart[d], visitOrder.data() + levelStart[d + 1]};
+    }
+
+    /**
+     * @brief Returns how many steps of the last run were bottom-up.
+     * @return Bottom-up step count.
+     */
+    uint32_t lastBottomUpSteps() const { return bottomUpSteps; }
+
+    /**
+     * @brief Enables or disables bottom-up steps (top-down only when disabled).
+     * @param on true to switch directions by the heuristic.
+     */
+    void setDirectionOptimizing(bool on) { directionOptimizing = on; }
+};
+
+#endif // BFS_ENGINE_H
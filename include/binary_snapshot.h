@@ -0,0 +1,130 @@
+/**
+ * @file binary_snapshot.h
+ * @brief Defines the versioned binary graph snapshot format and its memory-mapped reader.
+ */
+#ifndef BINARY_SNAPSHOT_H
+#define BINARY_SNAPSHOT_H
+
+#include "csr_graph.h"
+#include "id_map.h"
+#include "mapped_file.h"
+#include "user.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @struct SnapshotHeader
+ * @brief Fixed-size header at offset 0 of a binary snapshot file.
+ *
+ * Layout (all blocks 8-byte aligned, native little-endian):
+ *  - CSR block: uint32 offsets[numVertices+1], uint32 neighbors[numAdj]
+ *  - ID block: uint64 externalIds[numVertices] (dense index → user ID)
+ *  - user column block, one array per field with numUsers entries:
+ *    uint32 vertex, int32 age, then StrRef name, city, tags, email, password, profilePic
+ *  - string heap: the bytes referenced by every StrRef
+ */
+struct SnapshotHeader {
+    char magic[8];          ///< "REDSNAP" + '\0'.
+    uint32_t version;       ///< Format version (SNAPSHOT_VERSION).
+    uint32_t byteOrder;     ///< 0x01020304 as written by the producer.
+    uint64_t numVertices;   ///< Dense vertex count.
+    uint64_t numAdj;        ///< Directed adjacency entries (2 × edges).
+    uint64_t numUsers;      ///< Number of stored profiles.
+    uint64_t offsetsPos;    ///< File offset of the CSR offsets array.
+    uint64_t neighborsPos;  ///< File offset of the CSR neighbor array.
+    uint64_t idsPos;        ///< File offset of the external-ID array.
+    uint64_t usersPos;      ///< File offset of the user column block.
+    uint64_t heapPos;       ///< File offset of the string heap.
+    uint64_t heapSize;      ///< Size of the string heap in bytes.
+};
+
+/// Current binary snapshot format version.
+constexpr uint32_t SNAPSHOT_VERSION = 1;
+
+/**
+ * @struct StrRef
+ * @brief Reference to a string stored in the snapshot's string heap.
+ */
+struct StrRef {
+    uint32_t offset;   ///< Byte offset inside the heap.
+    uint32_t length;   ///< Length in bytes.
+};
+
+/**
+ * @class MappedSnapshot
+ * @brief Read-only view of a binary snapshot file, used in place from its memory mapping.
+ *
+ * Opening validates the header, block bounds and the CSR shape (sorted,
+ * loop-free, symmetric rows) in one O(n + m) pass; nothing is parsed or
+ * copied. graph() returns a CsrGraph over the mapped arrays that keeps the
+ * mapping alive for as long as it is referenced.
+ */
+class MappedSnapshot {
+private:
+    std::shared_ptr<MappedFile> file;
+    const SnapshotHeader* hdr;
+    const uint32_t* offsets;
+    const uint32_t* neighbors;
+    const uint64_t* extIds;
+    const uint32_t* userVertex;
+    const int32_t* userAge;
+    const StrRef* columns[6];     // name, city, tags, email, password, profilePic
+    const char* heap;
+
+    std::string_view str(int column, std::size_t i) const;
+public:
+    /**
+     * @brief Maps and validates a snapshot file.
+     * @param path Path to the snapshot.
+     * @throws std::runtime_error if the file is missing, truncated or not a snapshot.
+     */
+    explicit MappedSnapshot(const std::string& path);
+
+    /**
+     * @brief Returns the number of dense vertices.
+     * @return Vertex count.
+     */
+    uint32_t numVertices() const { return static_cast<uint32_t>(hdr->numVertices); }
+
+    /**
+     * @brief Returns the number of stored profiles.
+     * @return Profile count.
+     */
+    std::size_t numUsers() const { return static_cast<std::size_t>(hdr->numUsers); }
+
+    /**
+     * @brief Returns the external user ID of a dense vertex.
+     * @param v Dense vertex index.
+     * @return External user ID.
+     */
+    uint64_t externalId(uint32_t v) const { return extIds[v]; }
+
+    /**
+     * @brief Returns a CSR view over the mapped adjacency (no copy).
+     * @return Shared snapshot that keeps the mapping alive.
+     */
+    std::shared_ptr<const CsrGraph> graph() const;
+
+    /**
+     * @brief Materializes the i-th stored profile.
+     * @param i Profile row (0..numUsers()-1).
+     * @return User with every field copied out of the heap.
+     */
+    User user(std::size_t i) const;
+
+    /**
+     * @brief Writes a snapshot file.
+     * @param path Destination path.
+     * @param csr Adjacency over dense indices.
+     * @param ids Dense index ↔ external ID map (ids.size() == csr.numVertices()).
+     * @param users Profiles indexed by dense index (nullptr = no profile).
+     * @throws std::runtime_error if the file cannot be written.
+     */
+    static void write(const std::string& path, const CsrGraph& csr, const IdMap& ids,
+                      const std::vector<User*>& users);
+};
+
+#endif // BINARY_SNAPSHOT_H
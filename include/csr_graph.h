@@ -0,0 +1,165 @@
+/**
+ * @file csr_graph.h
+ * @brief Defines CsrGraph, an immutable compressed-sparse-row snapshot of the friendship graph.
+ */
+#ifndef CSR_GRAPH_H
+#define CSR_GRAPH_H
+
+#include "neighbor_list.h"
+#include "triangles.h"
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/**
+ * @struct NeighborSpan
+ * @brief Read-only view over the contiguous, sorted neighbor indices of one vertex.
+ */
+struct NeighborSpan {
+    const uint32_t* first; ///< First neighbor index.
+    const uint32_t* last;  ///< One past the last neighbor index.
+
+    const uint32_t* begin() const { return first; }
+    const uint32_t* end() const { return last; }
+    std::size_t size() const { return static_cast<std::size_t>(last - first); }
+};
+
+/**
+ * @class CsrGraph
+ * @brief Read-only adjacency in compressed-sparse-row form with dense vertex indices.
+ *
+ * Vertices are the graph's dense internal indices 0..n-1 (see IdMap); users
+ * without friendships are present with degree 0. The neighbors of vertex i
+ * are adjList[offsets[i] .. offsets[i+1]), sorted ascending, so
+ * traversals read one contiguous array instead of a separate allocation per
+ * user. A snapshot never changes after construction.
+ *
+ * The arrays are either owned by the snapshot or borrowed from external
+ * memory (e.g. a memory-mapped binary snapshot) kept alive by a shared
+ * handle, so a saved graph can be wrapped without copying. Triangle counts
+ * are computed on first use and then live with the snapshot they describe.
+ */
+class CsrGraph {
+private:
+    std::vector<uint32_t> ownOffsets;           // almacenamiento propio (vacío si es prestado)
+    std::vector<uint32_t> ownAdj;
+    const uint32_t* offsets;                    // n+1 desplazamientos en adjList
+    const uint32_t* adjList;                    // vecinos de todos los vértices, ordenados
+    uint32_t vertexCount;                       // número de vértices
+    std::shared_ptr<const void> backing;        // mantiene viva la memoria prestada
+    mutable std::once_flag trianglesOnce;       // el conteo se publica una sola vez
+    mutable TriangleStats triangleStats;
+public:
+    /**
+     * @brief Constructs an empty snapshot.
+     */
+    CsrGraph() : ownOffsets(1, 0), offsets(ownOffsets.data()), adjList(nullptr), vertexCount(0) {}
+
+    /**
+     * @brief Wraps existing CSR arrays without copying them.
+     * @param offsets Array of n+1 row offsets.
+     * @param adjList Array of offsets[n] sorted neighbor indices.
+     * @param n Number of vertices.
+     * @param backing Handle that keeps both arrays alive.
+     */
+    CsrGraph(const uint32_t* offsets, const uint32_t* adjList, uint32_t n,
+             std::shared_ptr<const void> backing)
+        : offsets(offsets), adjList(adjList), vertexCount(n), backing(std::move(backing)) {}
+
+    CsrGraph(const CsrGraph&) = delete;
+    CsrGraph& operator=(const CsrGraph&) = delete;
+
+    /**
+     * @brief Builds a snapshot from the mutable adjacency.
+     * @param adj Sorted neighbor list per internal index (may be shorter than n).
+     * @param n Number of internal indices assigned so far.
+     */
+    CsrGraph(const std::vector<NeighborList>& adj, uint32_t n);
+
+    /**
+     * @brief Returns the number of vertices in the snapshot.
+     * @return Number of dense vertex indices.
+     */
+    uint32_t numVertices() const { return vertexCount; }
+
+    /**
+     * @brief Returns the number of undirected edges in the snapshot.
+     * @return Number of edges.
+     */
+    std::size_t numEdges() const { return offsets[vertexCount] / 2; }
+
+    /**
+     * @brief Returns the raw row-offset array (n+1 entries).
+     * @return Pointer to the offsets.
+     */
+    const uint32_t* rowOffsets() const { return offsets; }
+
+    /**
+     * @brief Returns the raw neighbor array (2·numEdges() entries).
+     * @return Pointer to the concatenated neighbor rows.
+     */
+    const uint32_t* neighborArray() const { return adjList; }
+
+    /**
+     * @brief Returns the degree of a vertex.
+     * @param v Dense vertex index.
+     * @return Number of neighbors.
+     */
+    uint32_t degree(uint32_t v) const { return offsets[v + 1] - offsets[v]; }
+
+    /**
+     * @brief Returns the sorted neighbors of a vertex.
+     * @param v Dense vertex index.
+     * @return Span over the neighbor indices.
+     */
+    NeighborSpan neighbors(uint32_t v) const {
+        return { adjList + offsets[v], adjList + offsets[v + 1] };
+    }
+
+    /**
+     * @brief Checks whether two vertices are adjacent (binary search).
+     * @param u First dense index.
+     * @param v Second dense index.
+     * @return true if u and v are neighbors.
+     */
+    bool hasEdge(uint32_t u, uint32_t v) const;
+
+    /**
+     * @brief Computes the hop distance between two vertices.
+     * @param src Source dense index.
+     * @param dst Destination dense index.
+     * @return Number of hops, or -1 if unreachable.
+     */
+    int shortestPath(uint32_t src, uint32_t dst) const;
+
+    /**
+     * @brief Counts connected components, ignoring vertices without friendships.
+     * @return Number of connected components.
+     */
+    int componentCount() const;
+
+    /**
+     * @brief Approximates the diameter with a multi-source BFS from evenly spread vertices.
+     * @param samples Number of BFS sources (64 cost about one BFS).
+     * @return Largest distance found.
+     */
+    int approximateDiameter(int samples) const;
+
+    /**
+     * @brief Returns the exact triangle counts of this snapshot, counting them on first use.
+     *
+     * Concurrent first calls count once (std::call_once); the others wait and
+     * then read the same immutable result.
+     * @return Triangle statistics, valid while the snapshot lives.
+     */
+    const TriangleStats& triangles() const;
+
+    /**
+     * @brief Computes the average local clustering coefficient over vertices of degree ≥ 2.
+     * @return Mean clustering coefficient.
+     */
+    double averageClusteringCoefficient() const;
+};
+
+#endif // CSR_GRAPH_H
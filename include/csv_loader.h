@@ -0,0 +1,58 @@
+/**
+ * @file csv_loader.h
+ * @brief Declares the parallel, memory-mapped CSV parsers for edge and user files.
+ */
+#ifndef CSV_LOADER_H
+#define CSV_LOADER_H
+
+#include "user.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @struct CsvLoadStats
+ * @brief Summary of a CSV load: parsed rows, rejected lines and throughput.
+ */
+struct CsvLoadStats {
+    std::size_t rows = 0;        ///< Lines parsed successfully.
+    std::size_t malformed = 0;   ///< Non-empty lines that could not be parsed (skipped).
+    double seconds = 0.0;        ///< Wall-clock duration of the load.
+
+    /**
+     * @brief Returns the load throughput.
+     * @return Parsed rows per second (0 if no time was measured).
+     */
+    double rowsPerSecond() const { return seconds > 0.0 ? rows / seconds : 0.0; }
+};
+
+/**
+ * @brief Parses an edge file with lines "u,v" (extra columns are ignored).
+ *
+ * The file is mmap'ed and split into chunks at newline boundaries; each chunk
+ * is parsed on its own thread with std::from_chars, and the per-chunk results
+ * are concatenated in file order. Blank lines are skipped silently; lines
+ * without two unsigned integers are counted as malformed.
+ * @param path Path to the CSV file.
+ * @param stats Receives row and malformed-line counts (seconds is left to the caller).
+ * @return Edge pairs in file order.
+ * @throws std::runtime_error if the file cannot be opened.
+ */
+std::vector<std::pair<uint64_t, uint64_t>> parseEdgesCsv(const std::string& path, CsvLoadStats& stats);
+
+/**
+ * @brief Parses a user file with a header and lines "id,name,age,city,tags,email,password".
+ *
+ * Same chunked, multi-threaded scheme as parseEdgesCsv. Missing trailing
+ * columns are left empty; lines whose id or age are not integers are
+ * counted as malformed.
+ * @param path Path to the CSV file.
+ * @param stats Receives row and malformed-line counts (seconds is left to the caller).
+ * @return Parsed profiles in file order.
+ * @throws std::runtime_error if the file cannot be opened.
+ */
+std::vector<User> parseUsersCsv(const std::string& path, CsvLoadStats& stats);
+
+#endif // CSV_LOADER_H
@@ -0,0 +1,107 @@
+/**
+ * @file feed.h
+ * @brief Declares the feed engine: a k-way merge of per-author post lists with cursor pagination.
+ */
+#ifndef FEED_H
+#define FEED_H
+
+#include "post_store.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @struct FeedPage
+ * @brief One page of a feed, newest first.
+ */
+struct FeedPage {
+    std::vector<uint64_t> posts;   ///< Post IDs, newest first.
+    uint64_t next = 0;             ///< Cursor for the following page (pass it back to continue).
+    bool more = false;             ///< true if older posts remain after this page.
+};
+
+/**
+ * @struct PostRun
+ * @brief A sorted (ascending) array of post IDs, e.g. one author's posts or a cached timeline.
+ */
+struct PostRun {
+    const uint64_t* ids;   ///< First ID.
+    std::size_t size;      ///< Number of IDs.
+};
+
+/**
+ * @class FeedMerger
+ * @brief Reusable buffers for the k-way merge, so repeated page reads do not allocate.
+ *
+ * Fill runs (directly or with addAuthors), clear out, then call merge(); the
+ * merged IDs are appended to out. All vectors keep their capacity between
+ * calls. Not thread-safe: use one merger per thread.
+ */
+class FeedMerger {
+public:
+    std::vector<PostRun> runs;       ///< Ascending runs to merge.
+    std::vector<uint64_t> authors;   ///< Scratch list of author IDs for the caller.
+    std::vector<uint64_t> out;       ///< Merged post IDs, newest first.
+
+    /**
+     * @brief Adds each author's post list as a run (an author listed twice is added once).
+     * @param store Post storage.
+     * @param list Author IDs.
+     */
+    void addAuthors(const PostStore& store, const std::vector<uint64_t>& list);
+
+    /**
+     * @brief Appends up to limit merged IDs to out, newest first.
+     *
+     * An ID present in several runs is emitted once. With a floor, the merge
+     * stops before the first ID below it (used when older runs are incomplete).
+     * @param limit Maximum number of IDs to append.
+     * @param cursor 0 to start from the newest post, otherwise only IDs below it.
+     * @param floor Smallest ID that may be emitted (0 = no floor).
+     * @return true if the runs still hold IDs below the last one emitted.
+     */
+    bool merge(std::size_t limit, uint64_t cursor = 0, uint64_t floor = 0);
+
+private:
+    struct Head {
+        uint64_t id;            // post más nuevo pendiente de la corrida
+        const uint64_t* run;
+        std::size_t pos;
+    };
+    std::vector<Head> heap;
+    std::vector<const std::vector<uint64_t>*> lists;
+};
+
+/**
+ * @brief Merges sorted runs of post IDs, newest first, stopping after limit posts.
+ *
+ * An ID present in several runs is returned once. With a floor, the merge
+ * stops before the first ID below it (used when older runs are incomplete);
+ * FeedPage::more then also reports whether such IDs remain.
+ * @param runs Runs to merge (each ascending).
+ * @param limit Maximum number of posts in the page.
+ * @param cursor 0 for the first page, otherwise FeedPage::next of the previous page.
+ * @param floor Smallest ID that may be returned (0 = no floor).
+ * @return The page and its continuation cursor.
+ */
+FeedPage mergeRuns(const std::vector<PostRun>& runs, std::size_t limit,
+                   uint64_t cursor = 0, uint64_t floor = 0);
+
+/**
+ * @brief Merges the posts of several authors, newest first, stopping after limit posts.
+ *
+ * Post IDs grow with creation time, so every author's list in PostStore is
+ * already a sorted run. Each author is positioned with a binary search just
+ * below the cursor, then a max-heap over the run heads yields the next newest
+ * post until limit are taken: O(A log P + limit log A) for A authors, no
+ * matter how many posts exist in total.
+ * @param store Post storage.
+ * @param authors Author IDs whose posts make up the feed (duplicates are ignored).
+ * @param limit Maximum number of posts in the page.
+ * @param cursor 0 for the first page, otherwise FeedPage::next of the previous page.
+ * @return The page and its continuation cursor.
+ */
+FeedPage mergeFeed(const PostStore& store, const std::vector<uint64_t>& authors,
+                   std::size_t limit, uint64_t cursor = 0);
+
+#endif // FEED_H
@@ -7,8 +7,18 @@
 
 
 
-#include "hash_table.h"
+#include "neighbor_list.h"
+#include "csr_graph.h"
+#include "id_map.h"
+#include "csv_loader.h"
+#include "union_find.h"
+#include "diameter.h"
 #include "user.h"
+#include "pool.h"
+#include "avl_tree.h"
+#include "post_store.h"
+#include "feed.h"
+#include "timeline_cache.h"
 #include <string>
 #include <vector>
 #include <queue>
@@ -16,36 +26,131 @@
 #include <unordered_set>
 #include <limits>
 #include <cstdint>
+#include <memory>
+#include <iosfwd>
+#include <iterator>
 
 #include <nlohmann/json.hpp>
 
 /**
- * @struct Post
- * @brief Represents a user's status update or post.
+ * @class FriendRange
+ * @brief Read-only view of a user's friends that yields external IDs without copying.
+ *
+ * Walks the sorted dense indices of a NeighborList and maps each one through
+ * IdMap on dereference. The view is invalidated by any change to that
+ * user's friendships.
  */
-struct Post {
-    uint64_t userId;           ///< ID of the user who created the post.
-    std::string text;          ///< Content of the post.
-    std::time_t timestamp;     ///< Time when the post was created.
-    int likes = 0;             ///< Number of likes on the post.
-    std::vector<std::pair<std::string, std::time_t>> comments;  ///< Comments (text, timestamp).
+class FriendRange {
+private:
+    const uint32_t* first;
+    const uint32_t* last;
+    const IdMap* ids;
+public:
+    /**
+     * @class iterator
+     * @brief Forward iterator yielding external user IDs.
+     */
+    class iterator {
+    private:
+        const uint32_t* p;
+        const IdMap* ids;
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = uint64_t;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const uint64_t*;
+        using reference = uint64_t;
+
+        iterator(const uint32_t* p, const IdMap* ids) : p(p), ids(ids) {}
+        uint64_t operator*() const { return ids->external(*p); }
+        iterator& operator++() { ++p; return *this; }
+        iterator operator++(int) { iterator t = *this; ++p; return t; }
+        bool operator==(const iterator& o) const { return p == o.p; }
+        bool operator!=(const iterator& o) const { return p != o.p; }
+    };
+
+    /**
+     * @brief Creates a view over dense indices [first, last).
+     * @param first First neighbor index.
+     * @param last One past the last.
+     * @param ids Map used to translate indices to user IDs.
+     */
+    FriendRange(const uint32_t* first, const uint32_t* last, const IdMap* ids)
+        : first(first), last(last), ids(ids) {}
+
+    iterator begin() const { return iterator(first, ids); }
+    iterator end() const { return iterator(last, ids); }
+    std::size_t size() const { return static_cast<std::size_t>(last - first); }
+    bool empty() const { return first == last; }
+    uint64_t operator[](std::size_t i) const { return ids->external(first[i]); }
+
+    /**
+     * @brief Returns the underlying dense indices (sorted).
+     * @return Span over the internal neighbor indices.
+     */
+    NeighborSpan indices() const { return {first, last}; }
+};
+
+/**
+ * @struct IdSpan
+ * @brief Read-only view over a contiguous list of 64-bit IDs owned by Graph.
+ *
+ * Returned by postIdsOf, followersOf and followingOf instead of a copy. The
+ * view is invalidated by the next change to the list it points into (a new
+ * post by that author, a follow or unfollow involving that user, removeUser).
+ */
+struct IdSpan {
+    const uint64_t* first = nullptr; ///< First ID.
+    const uint64_t* last = nullptr;  ///< One past the last ID.
+
+    const uint64_t* begin() const { return first; }
+    const uint64_t* end() const { return last; }
+    std::size_t size() const { return static_cast<std::size_t>(last - first); }
+    bool empty() const { return first == last; }
+    uint64_t operator[](std::size_t i) const { return first[i]; }
 };
 
 /**
  * @class Graph
  * @brief Represents a social network graph with user profiles and friendships.
+ *
+ * Public methods take external 64-bit user IDs. Internally every user seen in
+ * a profile or an edge gets a dense uint32_t index from IdMap, and all
+ * friendship structures (adjacency, snapshots, BFS buffers) use that index.
  */
 class Graph {
 private:
-    std::unordered_map<uint64_t, User*> users;   // perfiles
+    IdMap ids;                                   // ID externo ↔ índice interno denso
+    ObjectPool<User> profiles;                   // almacenamiento de los perfiles (slabs)
+    std::vector<User*> users;                    // perfiles por índice interno (nullptr = sin perfil)
     std::unordered_set<std::string> usernames;   // para verificar unicidad de nombre
-    HashTable adj;              // userID → lista de vecinos (amistades)
+    std::vector<NeighborList> adj;  // índice interno → vecinos ordenados (índices internos)
+    int active;                 // vértices con al menos una amistad
     int edges;                  // cantidad de aristas no dirigidas
     uint64_t nextId;   // siguiente ID a asignar
-    std::vector<Post> posts;   ///< All posts in the network.
+    PostStore posts;           ///< All posts in the network, by post ID and by author.
     // Dirección de seguidores y seguidos
     std::unordered_map<uint64_t, std::vector<uint64_t>> followersMap_;  ///< Map of user → list of followers
     std::unordered_map<uint64_t, std::vector<uint64_t>> followingMap_;  ///< Map of user → list of users they follow
+    IdMap boardKeys;            // ID externo ↔ clave de los rankings (no crea vértices)
+    AVLTree followerBoard;      // clave de ranking → nº de seguidores (solo usuarios con alguno)
+    AVLTree likeBoard;          // clave de ranking → likes recibidos en sus posts (solo > 0)
+    mutable std::unique_ptr<TimelineCache> timelines;   // feeds por difusión al escribir (nullptr = solo pull)
+    mutable FeedMerger merger;                    // buffers reutilizables, solo para forEachFeedPost
+    mutable std::shared_ptr<const CsrGraph> csr;  // snapshot CSR en caché; se invalida al mutar aristas
+    mutable UnionFind comps;                      // componentes conexas, actualizadas en addEdge
+    mutable bool compsStale = false;              // true: reconstruir comps desde el snapshot
+
+    const UnionFind& components() const;         // comps al día (reconstruye si hace falta)
+
+    uint32_t internVertex(uint64_t id);          // índice interno; invalida anillos de seguidores si es nuevo
+    User* setProfile(User&& u);                  // crea el perfil en el pool y lo indexa
+    void feedAuthors(uint64_t userId, std::vector<uint64_t>& out) const;   // el usuario, sus amigos y sus seguidos
+    bool mergeFeedInto(FeedMerger& m, uint64_t userId, std::size_t limit, uint64_t cursor) const;   // página en m.out
+    void fanOut(uint64_t author, uint64_t postId);               // empuja el post a los anillos de su audiencia
+    void refillTimeline(FeedMerger& m, uint32_t reader, uint64_t userId) const; // reconstruye un anillo desde el pull
+    void invalidateTimeline(uint64_t userId);                    // sus fuentes cambiaron
+    friend class GraphJsonReader;
 public:
     /**
      * @brief Constructs an empty Graph.
@@ -57,7 +162,19 @@ public:
      * @param u First user ID.
      * @param v Second user ID.
      */
-    void addEdge(int u, int v);           // u ↔ v
+    void addEdge(uint64_t u, uint64_t v);           // u ↔ v
+
+    /**
+     * @brief Adds many undirected friendships at once.
+     *
+     * Interns every endpoint, sorts and dedupes the directed pairs in
+     * parallel, drops self-loops and friendships that already exist, and then
+     * merges each vertex's new neighbors into its sorted list in a single pass
+     * (vertex ranges are filled by separate threads). Equivalent to calling
+     * addEdge for every pair, but without per-edge shifting or reallocation.
+     * @param list Pairs (u, v) of user IDs.
+     */
+    void addEdges(const std::vector<std::pair<uint64_t, uint64_t>>& list);
 
     /**
      * @brief Checks if two users are directly connected (friends).
@@ -65,34 +182,53 @@ public:
      * @param v Second user ID.
      * @return true if users are friends, false otherwise.
      */
-    bool areFriends(int u, int v) const;
+    bool areFriends(uint64_t u, uint64_t v) const;
 
     /**
      * @brief Returns the number of friends (degree) of a user.
      * @param u User ID.
      * @return Number of adjacent vertices.
      */
-    int degree(int u) const;
+    int degree(uint64_t u) const;
 
     /**
      * @brief Retrieves the list of neighbor IDs for a user.
      * @param u User ID.
-     * @return Pointer to a LinkedList of neighbor IDs.
+     * @return View of the friends' user IDs (empty if none), valid until u's friendships change.
+     */
+    FriendRange neighbors(uint64_t u) const;
+
+    /**
+     * @brief Counts the friends two users have in common (sorted-row intersection).
+     * @param a First user ID.
+     * @param b Second user ID.
+     * @return Number of mutual friends.
+     */
+    std::size_t mutualFriendCount(uint64_t a, uint64_t b) const;
+
+    /**
+     * @brief Lists the friends two users have in common.
+     * @param a First user ID.
+     * @param b Second user ID.
+     * @return Mutual friends' user IDs.
      */
-    LinkedList* neighbors(int u) const;
+    std::vector<uint64_t> mutualFriends(uint64_t a, uint64_t b) const;
 
     /**
      * @brief Loads user profiles from a CSV file.
+     *
+     * The file is parsed in parallel from a memory mapping (see parseUsersCsv).
      * @param path Path to a CSV file with lines id,name,age,city,tags.
+     * @return Rows loaded, malformed lines skipped and elapsed time.
      */
-    void loadUsersCSV(const std::string& path);
+    CsvLoadStats loadUsersCSV(const std::string& path);
 
     /**
      * @brief Retrieves a user profile by ID.
      * @param id The user ID.
      * @return Pointer to the User object, or nullptr if not found.
      */
-    User* getUser(int id) const;
+    User* getUser(uint64_t id) const;
 
     /**
      * @brief Adds a new user to the graph.
@@ -101,6 +237,16 @@ public:
      */
     bool addUser(const User& u);
 
+    /**
+     * @brief Deactivates a user: drops the profile, every friendship and follow relation.
+     *
+     * The user's adjacency entry is removed from the table, as is the entry
+     * of any friend left without friendships. Posts are kept.
+     * @param id The user ID to remove.
+     * @return true if the user had a profile or friendships, false otherwise.
+     */
+    bool removeUser(uint64_t id);
+
     /**
      * @brief Checks if a username is already taken.
      * @param name The username to check.
@@ -127,17 +273,59 @@ public:
      */
     static Graph fromJson(const nlohmann::json& j);
 
+    /**
+     * @brief Streams the graph as JSON (same schema as toJson) without building a DOM.
+     *
+     * Users are written one object per line and edges one pair per line.
+     * @param os Destination stream.
+     */
+    void writeJson(std::ostream& os) const;
+
+    /**
+     * @brief Reads a graph from a JSON stream with a SAX parser (see GraphJsonReader).
+     *
+     * Users and edges are inserted while parsing, so memory use does not depend
+     * on the size of the document beyond the resulting graph.
+     * @param is Source stream.
+     * @return The loaded Graph.
+     * @throws std::runtime_error on malformed JSON or missing user fields.
+     */
+    static Graph readJson(std::istream& is);
+
+    /**
+     * @brief Writes the graph to a binary snapshot (see binary_snapshot.h).
+     * @param path Destination file path.
+     * @throws std::runtime_error if the file cannot be written.
+     */
+    void saveBinary(const std::string& path) const;
+
+    /**
+     * @brief Loads a graph from a binary snapshot.
+     *
+     * The file is memory-mapped and the CSR used by the analytics is served
+     * directly from the mapping; only profiles and the mutable adjacency are
+     * materialized.
+     * @param path Path to a file written by saveBinary.
+     * @return The loaded Graph.
+     * @throws std::runtime_error if the file is missing or invalid.
+     */
+    static Graph loadBinary(const std::string& path);
+
     /**
      * @brief Loads friendship edges from a CSV file.
+     *
+     * The file is parsed in parallel from a memory mapping (see parseEdgesCsv)
+     * and the edges are inserted with addEdges.
      * @param path Path to a CSV file with lines u,v for each edge.
+     * @return Rows loaded, malformed lines skipped and elapsed time.
      */
-    void loadCSV(const std::string& path);
+    CsvLoadStats loadCSV(const std::string& path);
 
     /**
      * @brief Gets the number of vertices (users) in the graph.
      * @return Number of vertices.
      */
-    int numVertices() const { return adj.size(); }
+    int numVertices() const { return active; }
 
     /**
      * @brief Gets the number of edges (friendships) in the graph.
@@ -145,19 +333,71 @@ public:
      */
     int numEdges() const { return edges; }
 
+    /**
+     * @brief Returns an immutable CSR snapshot of the friendship adjacency.
+     *
+     * The snapshot is built on first use and cached until the next edge
+     * change; callers may keep the returned pointer alive past later
+     * mutations, it simply stops reflecting them.
+     * @return Shared pointer to the current snapshot.
+     */
+    std::shared_ptr<const CsrGraph> snapshot() const;
+
+    /**
+     * @brief Returns the dictionary between external user IDs and the dense
+     *        internal indices used by snapshot().
+     * @return Reference to the ID map.
+     */
+    const IdMap& idMap() const { return ids; }
+
     /**
      * @brief Counts connected components using BFS.
      * @return Number of connected components.
      */
     int bfsComponentCount() const;
 
+    /**
+     * @brief Returns the number of connected components from the union-find forest.
+     *
+     * O(1) while only edges are added; after removeUser or a large bulk load the
+     * forest is rebuilt once in parallel on the next query. Apart from that
+     * rebuild it only reads, so concurrent calls (and sameComponent) on a const
+     * graph are safe once one query has run since the last mutation.
+     * @return Number of connected components (users without friends are not counted).
+     */
+    int componentCount() const;
+
+    /**
+     * @brief Checks whether two users are in the same connected component.
+     *
+     * Walks the union-find forest without compressing it; same threading
+     * rule as componentCount.
+     * @param a First user ID.
+     * @param b Second user ID.
+     * @return true if a path of friendships joins them.
+     */
+    bool sameComponent(uint64_t a, uint64_t b) const;
+
     /**
      * @brief Computes shortest path length between two users.
+     *
+     * The bidirectional search uses per-thread scratch buffers, so concurrent
+     * calls on a const graph share no state once its snapshot is current.
      * @param src Source user ID.
      * @param dst Destination user ID.
      * @return Number of hops in shortest path or -1 if unreachable.
      */
-    int shortestPath(int src, int dst) const;
+    int shortestPath(uint64_t src, uint64_t dst) const;
+
+    /**
+     * @brief Returns one shortest chain of friendships between two users.
+     *
+     * Same per-thread buffers and threading rules as shortestPath.
+     * @param src Source user ID.
+     * @param dst Destination user ID.
+     * @return User IDs from src to dst inclusive ({src} if equal), or empty if not connected.
+     */
+    std::vector<uint64_t> shortestPathRoute(uint64_t src, uint64_t dst) const;
 
     /**
      * @brief Calculates average degree (2E/V) of the graph.
@@ -167,17 +407,65 @@ public:
 
     /**
      * @brief Approximates the graph diameter by sampling.
+     *
+     * Sources are spread over the graph and traversed 64 at a time by a
+     * bit-parallel BFS (see MultiSourceBfs).
      * @param samples Number of nodes to sample.
      * @return Maximum shortest path found from samples.
      */
-    int approximateDiameter(int samples = 5) const;
+    int approximateDiameter(int samples = 64) const;
+
+    /**
+     * @brief Computes hop distances from every source to every target in batched sweeps.
+     * @param sources Source user IDs.
+     * @param targets Target user IDs.
+     * @return result[i][j] = distance(sources[i], targets[j]), -1 if unreachable or unknown.
+     */
+    std::vector<std::vector<int>> distances(const std::vector<uint64_t>& sources,
+                                            const std::vector<uint64_t>& targets) const;
+
+    /**
+     * @brief Computes the exact diameter with iFUB (see exactDiameter in diameter.h).
+     * @return Diameter plus the number of BFS runs it needed.
+     */
+    DiameterStats exactDiameter() const;
+
+    /**
+     * @brief Returns the largest distance from a user to anyone reachable.
+     * @param u User ID.
+     * @return Eccentricity of u, or -1 if u is unknown.
+     */
+    int eccentricity(uint64_t u) const;
 
     /**
      * @brief Computes the average clustering coefficient.
+     *
+     * Triangles are counted once per snapshot and stored in it (see
+     * CsrGraph::triangles), so this and the other clustering reads are safe
+     * to call concurrently on a const graph once its snapshot is current.
      * @return Mean clustering coefficient across vertices.
      */
     double averageClusteringCoefficient() const;
 
+    /**
+     * @brief Returns the local clustering coefficient of one user.
+     * @param u User ID.
+     * @return Fraction of pairs of u's friends that are friends (0 if fewer than 2 friends).
+     */
+    double localClustering(uint64_t u) const;
+
+    /**
+     * @brief Returns the global clustering coefficient (transitivity).
+     * @return 3 × triangles / connected triples.
+     */
+    double transitivity() const;
+
+    /**
+     * @brief Returns the number of distinct friendship triangles.
+     * @return Triangle count.
+     */
+    uint64_t triangleCount() const;
+
     /**
      * @brief Retrieves all user IDs in the graph.
      * @return A vector of user IDs.
@@ -188,38 +476,132 @@ public:
      * @brief Adds a new post for a user.
      * @param userId The ID of the user making the post.
      * @param text The content of the post.
+     * @return The new post's ID.
+     */
+    uint64_t addPost(uint64_t userId, const std::string& text);
+
+    /**
+     * @brief Looks up a post by ID.
+     * @param postId Post ID returned by addPost.
+     * @return The post, or nullptr if the ID is unknown.
      */
-    void addPost(uint64_t userId, const std::string& text);
+    const Post* getPost(uint64_t postId) const;
 
     /**
      * @brief Retrieves all posts made by a specific user.
      * @param userId The user ID whose posts to retrieve.
-     * @return Vector of Post objects for the user.
+     * @return Post records for the user, oldest first (their text is valid while the graph lives).
      */
     std::vector<Post> getPostsForUser(uint64_t userId) const;
 
+    /**
+     * @brief Returns the IDs of a user's posts without copying them.
+     * @param userId The author's user ID.
+     * @return Post IDs, oldest first; valid until that user posts again.
+     */
+    IdSpan postIdsOf(uint64_t userId) const;
+
     /**
      * @brief Increments like count for a specific post.
-     * @param userId ID of the user who made the post.
-     * @param timestamp Timestamp of the post to like.
+     * @param postId ID of the post to like.
+     * @return false if the post does not exist.
      */
-    void likePost(uint64_t userId, std::time_t timestamp);
+    bool likePost(uint64_t postId);
 
     /**
      * @brief Adds a comment to a specific post.
-     * @param userId ID of the user who made the post.
-     * @param timestamp Timestamp of the post to comment on.
+     * @param postId ID of the post to comment on.
      * @param text The comment text.
+     * @return false if the post does not exist.
+     */
+    bool addComment(uint64_t postId, const std::string& text);
+
+    /**
+     * @brief Retrieves one page of a post's comments, oldest first.
+     * @param postId ID of the post.
+     * @param limit Maximum number of comments in the page.
+     * @param cursor 0 for the first page, otherwise CommentPage::next of the previous one.
+     * @return Comments of the page (text valid while the graph lives) and the cursor to continue.
+     */
+    CommentPage getComments(uint64_t postId, std::size_t limit, uint64_t cursor = 0) const;
+
+    /**
+     * @brief Reports the memory held by posts, comments and their text.
+     * @return Byte counts, including bytes per post.
      */
-    void addComment(uint64_t userId, std::time_t timestamp, const std::string& text);
+    PostStoreStats postStats() const;
 
     /**
-     * @brief Retrieves the feed posts for a user (own posts and those of friends).
+     * @brief Retrieves the feed posts for a user (own posts, friends' and followed users').
+     *
+     * Merges with its own local buffers, so concurrent calls on a const graph
+     * are safe as long as the timeline cache is disabled (with the cache, a
+     * read may refill the reader's ring).
      * @param userId The ID of the user whose feed to get.
-     * @return Vector of Post objects for the feed.
+     * @return Post records for the feed, newest first (their text is valid while the graph lives).
      */
     std::vector<Post> getFeed(uint64_t userId) const;
 
+    /**
+     * @brief Retrieves one page of a user's feed (as getFeed), newest first.
+     *
+     * Cost depends on the page size and the number of sources, not on the
+     * total number of posts (see mergeFeed in feed.h). With the timeline
+     * cache enabled the page comes from the reader's ring instead. Uses local
+     * merge buffers: concurrent calls on a const graph are safe while the
+     * timeline cache is disabled (with the cache, a read may refill a ring).
+     * @param userId The ID of the user whose feed to get.
+     * @param limit Maximum number of posts in the page.
+     * @param cursor 0 for the first page, otherwise FeedPage::next of the previous one.
+     * @return Post IDs of the page and the cursor to continue.
+     */
+    FeedPage feedPage(uint64_t userId, std::size_t limit, uint64_t cursor = 0) const;
+
+    /**
+     * @brief Visits one page of a user's feed in place, without copying posts or IDs.
+     *
+     * Same page as feedPage, but the merge runs in buffers kept by the graph
+     * (feedPage and getFeed use local ones), so a warm refresh does not
+     * allocate. fn receives a const Post& that points into the post store: it
+     * stays valid until the next addPost and must not be kept beyond that.
+     * Because the buffers are shared, fn must not call forEachFeedPost on the
+     * same graph, and two threads must not call it on one graph at once.
+     * @param userId The ID of the user whose feed to visit.
+     * @param limit Maximum number of posts to visit (at least 1).
+     * @param fn Callable as fn(const Post&), newest post first.
+     * @param cursor 0 for the first page, otherwise the value returned by the previous call.
+     * @return Cursor for the next page, or 0 if the feed is exhausted.
+     */
+    template <class Fn>
+    uint64_t forEachFeedPost(uint64_t userId, std::size_t limit, Fn&& fn, uint64_t cursor = 0) const {
+        bool more = mergeFeedInto(merger, userId, limit, cursor);
+        for (uint64_t id : merger.out) fn(*posts.get(id));
+        return more && !merger.out.empty() ? merger.out.back() : 0;
+    }
+
+    /**
+     * @brief Turns on fan-out-on-write feeds (see TimelineCache).
+     *
+     * From then on addPost pushes each post ID into the rings of the author's
+     * friends and followers, and feedPage reads a reader's ring, merging in
+     * only the reader's own posts and those of celebrity authors (audience
+     * above the threshold), which are pulled at read time instead. Pages are
+     * identical to the pull-only ones. Enabling again resets the cache.
+     * @param config Ring capacity and celebrity threshold.
+     */
+    void enableTimelineCache(const TimelineConfig& config = TimelineConfig());
+
+    /**
+     * @brief Turns the timeline cache off and frees it; feeds are pulled again.
+     */
+    void disableTimelineCache();
+
+    /**
+     * @brief Returns the timeline cache, if enabled.
+     * @return The cache (for its counters), or nullptr.
+     */
+    const TimelineCache* timelineCache() const { return timelines.get(); }
+
 /**
  * @brief Hacer que un usuario siga a otro.
  * @param followerId ID del seguidor.
@@ -248,6 +630,48 @@ std::vector<uint64_t> getFollowers(uint64_t userId) const;
  */
 std::vector<uint64_t> getFollowing(uint64_t userId) const;
 
+/**
+ * @brief Vista sin copia de los seguidores de un usuario.
+ * @param userId El ID del usuario.
+ * @return IDs de seguidores; válida hasta el próximo follow/unfollow que lo involucre.
+ */
+IdSpan followersOf(uint64_t userId) const;
+
+/**
+ * @brief Vista sin copia de los usuarios a los que sigue un usuario.
+ * @param userId El ID del usuario.
+ * @return IDs de seguidos; válida hasta el próximo follow/unfollow que lo involucre.
+ */
+IdSpan followingOf(uint64_t userId) const;
+
+    /**
+     * @brief Returns the live "most followed" leaderboard.
+     * @param k Maximum number of entries.
+     * @return Pairs (user ID, follower count), highest first (ties: the user who entered the board last first).
+     */
+    std::vector<std::pair<uint64_t, int>> mostFollowed(int k) const;
+
+    /**
+     * @brief Returns the live "most liked" leaderboard (likes summed over each author's posts).
+     * @param k Maximum number of entries.
+     * @return Pairs (user ID, total likes), highest first.
+     */
+    std::vector<std::pair<uint64_t, int>> mostLiked(int k) const;
+
+    /**
+     * @brief Returns a user's position in the "most followed" leaderboard.
+     * @param u User ID.
+     * @return 1-based rank, or -1 if the user has no followers.
+     */
+    int followerRank(uint64_t u) const;
+
+    /**
+     * @brief Returns a user's position in the "most liked" leaderboard.
+     * @param u User ID.
+     * @return 1-based rank, or -1 if the user's posts have no likes.
+     */
+    int likeRank(uint64_t u) const;
+
 /**
  * @brief Buscar usuarios por nombre.
  * @param name El nombre parcial o completo a buscar.
@@ -1,35 +1,50 @@
 /**
  * @file hash_table.h
- * @brief Implements a hash table mapping integer keys to LinkedList values via chaining.
+ * @brief Implements a hash table mapping integer keys to LinkedList values via open addressing.
  */
 #ifndef HASH_TABLE_H
 #define HASH_TABLE_H
 
 #include "linked_list.h"
-#include <climits>
+#include <cstdint>
 #include <vector>
 
 /**
  * @class HashTable
  * @brief A hash table storing integer keys with associated LinkedList* values.
+ *
+ * Open addressing with linear probing over a power-of-two slot array. Each
+ * slot has a one-byte control tag: EMPTY, or the low 7 bits of the key's hash.
+ * Lookups compare 16 control bytes at once (SSE2 when available) and only
+ * read keys whose tag matches. Removal shifts later entries of the probe
+ * chain back into the freed slot, so there are no tombstones, and the table
+ * halves its capacity when occupancy drops below a quarter of the load limit.
+ * The table owns its values.
  */
 class HashTable {
 private:
     int* keys;               // claves (userID)
     LinkedList** values;     // punteros a listas de vecinos
-    bool* used;              // celda ocupada
-    int capacity;            // tamaño del arreglo
+    int8_t* ctrl;            // byte de control por celda (+15 espejo al final)
+    int capacity;            // tamaño del arreglo (potencia de 2)
+    int minCapacity;         // capacidad inicial: nunca se encoge por debajo
     int sz;                  // pares almacenados
     float maxLoad;
-    static const int EMPTY = INT_MIN;
+    static const int8_t EMPTY = -128;    // 0x80: celda libre
+    static const int GROUP = 16;         // bytes de control por comparación
 
-    int hash(int key) const;             // hash base‑37 sencillo
-    void rehash();                       // duplica capacidad
-    int probe(int key) const;            // encuentra índice para clave (inserción/búsqueda)
+    static uint64_t hash(int key);       // mezclador multiplicativo/xor-shift
+    uint32_t matchGroup(int pos, int8_t tag) const;  // bits de celdas con ese tag
+    uint32_t emptyGroup(int pos) const;              // bits de celdas libres
+    void setCtrl(int idx, int8_t tag);   // escribe el tag y su espejo
+    void allocate(int cap);              // reserva arreglos vacíos
+    void rehash(int newCap);             // redimensiona y reinserta
+    int probe(int key) const;            // índice de la clave o -1
+    int home(int key) const;             // celda inicial de la clave
 public:
     /**
      * @brief Constructs a HashTable.
-     * @param cap Initial capacity (number of buckets), default is 101.
+     * @param cap Initial capacity (rounded up to a power of two, at least 16), default is 101.
      * @param load Maximum load factor before rehashing, default is 0.7.
      */
     explicit HashTable(int cap = 101, float load = 0.7f);
@@ -38,6 +53,20 @@ public:
      */
     ~HashTable();
 
+    HashTable(const HashTable&) = delete;
+    HashTable& operator=(const HashTable&) = delete;
+    /**
+     * @brief Takes ownership of another table's slots and values.
+     * @param other Table left empty after the move.
+     */
+    HashTable(HashTable&& other) noexcept;
+    /**
+     * @brief Releases the current contents and takes ownership of another table's.
+     * @param other Table left empty after the move.
+     * @return Reference to this table.
+     */
+    HashTable& operator=(HashTable&& other) noexcept;
+
     /**
      * @brief Retrieves the LinkedList associated with a key.
      * @param key The key to look up.
@@ -50,12 +79,26 @@ public:
      * @param value Pointer to the LinkedList of values for this key.
      */
     void put(int key, LinkedList* value);
+    /**
+     * @brief Removes a key and deletes its LinkedList.
+     *
+     * Uses backward-shift deletion and may shrink the table when it becomes
+     * sparse. Does nothing if the key is absent.
+     * @param key The key to remove.
+     * @return True if the key was present.
+     */
+    bool remove(int key);
     /**
      * @brief Checks existence of a key in the table.
      * @param key The key to check.
      * @return True if the key exists, false otherwise.
      */
     bool containsKey(int key) const;
+    /**
+     * @brief Grows the table once so that n keys fit without further rehashing.
+     * @param n Expected number of keys.
+     */
+    void reserve(int n);
     /**
      * @brief Returns the number of stored key-value pairs.
      * @return Current number of elements in the table.
@@ -74,4 +117,4 @@ public:
     std::vector<int> keySet() const;
 };
 
-#endif // HASH_TABLE_H
\ No newline at end of file
+#endif // HASH_TABLE_H
@@ -0,0 +1,72 @@
+/**
+ * @file id_map.h
+ * @brief Defines IdMap, the dictionary between external 64-bit user IDs and dense internal indices.
+ */
+#ifndef ID_MAP_H
+#define ID_MAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class IdMap
+ * @brief Assigns compact uint32_t indices to external uint64_t user IDs in insertion order.
+ *
+ * Internal indices are dense (0..size()-1), so every per-user structure can be
+ * a plain array indexed by them. Lookups from external to internal use an
+ * open-addressing table with power-of-two capacity and a 64-bit mixer.
+ */
+class IdMap {
+private:
+    std::vector<uint64_t> slotKeys;   // tabla abierta: ID externo por celda
+    std::vector<uint32_t> slotVals;   // índice interno por celda (NONE = vacía)
+    std::vector<uint64_t> ext;        // índice interno → ID externo
+    std::size_t mask;                 // capacidad - 1
+
+    static uint64_t mix(uint64_t x);  // mezclador splitmix64
+    void rebuild(std::size_t cap);    // redimensiona la tabla abierta
+public:
+    /// Marker for "no internal index".
+    static constexpr uint32_t NONE = UINT32_MAX;
+
+    /**
+     * @brief Constructs an empty map.
+     */
+    IdMap();
+
+    /**
+     * @brief Returns the internal index of an external ID, assigning the next one if new.
+     * @param id External user ID.
+     * @return Dense internal index.
+     */
+    uint32_t intern(uint64_t id);
+
+    /**
+     * @brief Looks up the internal index of an external ID.
+     * @param id External user ID.
+     * @return Dense internal index, or NONE if the ID was never interned.
+     */
+    uint32_t find(uint64_t id) const;
+
+    /**
+     * @brief Returns the external ID of an internal index.
+     * @param v Dense internal index (must be < size()).
+     * @return External user ID.
+     */
+    uint64_t external(uint32_t v) const { return ext[v]; }
+
+    /**
+     * @brief Returns the number of interned IDs.
+     * @return Number of dense indices handed out.
+     */
+    uint32_t size() const { return static_cast<uint32_t>(ext.size()); }
+
+    /**
+     * @brief Pre-allocates room for at least n IDs.
+     * @param n Expected number of IDs.
+     */
+    void reserve(std::size_t n);
+};
+
+#endif // ID_MAP_H
@@ -0,0 +1,84 @@
+/**
+ * @file intersect.h
+ * @brief Declares sorted uint32_t set-intersection kernels with runtime CPU dispatch.
+ *
+ * Every kernel takes two strictly increasing arrays (e.g. CSR neighbor rows)
+ * and either counts the common elements or writes them, in ascending order, to
+ * an output buffer with room for min(na, nb) values. The plain intersectCount /
+ * intersect entry points pick a kernel per call: galloping when one list is
+ * much longer than the other, otherwise the AVX2 block kernel on CPUs that
+ * support it, otherwise the scalar merge.
+ */
+#ifndef INTERSECT_H
+#define INTERSECT_H
+
+#include <cstddef>
+#include <cstdint>
+
+/// Size ratio from which intersectCount / intersect switch to galloping.
+constexpr std::size_t GALLOP_RATIO = 32;
+
+/**
+ * @brief Reports whether the AVX2 kernels can run on this CPU.
+ * @return true if AVX2 was detected at runtime.
+ */
+bool intersectHasAvx2();
+
+/**
+ * @brief Counts common elements, choosing the kernel from the sizes and the CPU.
+ * @param a First sorted array.
+ * @param na Length of a.
+ * @param b Second sorted array.
+ * @param nb Length of b.
+ * @return |a ∩ b|.
+ */
+std::size_t intersectCount(const uint32_t* a, std::size_t na, const uint32_t* b, std::size_t nb);
+
+/**
+ * @brief Writes the common elements, choosing the kernel from the sizes and the CPU.
+ * @param a First sorted array.
+ * @param na Length of a.
+ * @param b Second sorted array.
+ * @param nb Length of b.
+ * @param out Output buffer (at least min(na, nb) entries).
+ * @return Number of elements written.
+ */
+std::size_t intersect(const uint32_t* a, std::size_t na, const uint32_t* b, std::size_t nb,
+                      uint32_t* out);
+
+/**
+ * @brief Branch-light linear merge (count only).
+ */
+std::size_t intersectCountScalar(const uint32_t* a, std::size_t na, const uint32_t* b, std::size_t nb);
+
+/**
+ * @brief Linear merge writing the common elements.
+ */
+std::size_t intersectScalar(const uint32_t* a, std::size_t na, const uint32_t* b, std::size_t nb,
+                            uint32_t* out);
+
+/**
+ * @brief Exponential + binary search of each element of the shorter list in the longer one.
+ *
+ * O(small · log(large / small)); the better choice when the sizes are very skewed.
+ */
+std::size_t intersectCountGalloping(const uint32_t* a, std::size_t na, const uint32_t* b, std::size_t nb);
+
+/**
+ * @brief Galloping intersection writing the common elements.
+ */
+std::size_t intersectGalloping(const uint32_t* a, std::size_t na, const uint32_t* b, std::size_t nb,
+                               uint32_t* out);
+
+/**
+ * @brief AVX2 8×8 block compare (count only); falls back to the scalar merge without AVX2.
+ */
+std::size_t intersectCountAvx2(const uint32_t* a, std::size_t na, const uint32_t* b, std::size_t nb);
+
+/**
+ * @brief AVX2 8×8 block compare writing the common elements; scalar fallback without AVX2.
+ */
+std::size_t intersectAvx2(const uint32_t* a, std::size_t na, const uint32_t* b, std::size_t nb,
+                          uint32_t* out);
+
+#endif // INTERSECT_H
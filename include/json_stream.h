@@ -0,0 +1,86 @@
+/**
+ * @file json_stream.h
+ * @brief Declares the SAX handler that streams a JSON network into a Graph.
+ */
+#ifndef JSON_STREAM_H
+#define JSON_STREAM_H
+
+#include <nlohmann/json.hpp>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+class Graph;
+
+/**
+ * @class GraphJsonReader
+ * @brief nlohmann SAX handler that feeds users and edges into a Graph while parsing.
+ *
+ * Accepts the format written by Graph::writeJson / toJson:
+ * {"users":[{"id":..,"name":..,...}, ...], "edges":[[u,v], ...]}.
+ * Each user is added as soon as its object closes and edges are inserted in
+ * batches of BATCH pairs, so no DOM of the whole file is ever built. Unknown
+ * keys are skipped.
+ */
+class GraphJsonReader : public nlohmann::json_sax<nlohmann::json> {
+public:
+    /// Edges buffered before each Graph::addEdges call.
+    static constexpr std::size_t BATCH = 1 << 18;
+
+    /**
+     * @brief Creates a reader that fills the given graph.
+     * @param g Destination graph.
+     */
+    explicit GraphJsonReader(Graph& g);
+
+    /**
+     * @brief Inserts the buffered edges and updates the next free user ID.
+     *
+     * Call once after a successful nlohmann::json::sax_parse.
+     */
+    void finish();
+
+    bool null() override;
+    bool boolean(bool val) override;
+    bool number_integer(number_integer_t val) override;
+    bool number_unsigned(number_unsigned_t val) override;
+    bool number_float(number_float_t val, const string_t& s) override;
+    bool string(string_t& val) override;
+    bool binary(binary_t& val) override;
+    bool start_object(std::size_t elements) override;
+    bool end_object() override;
+    bool start_array(std::size_t elements) override;
+    bool end_array() override;
+    bool key(string_t& val) override;
+    bool parse_error(std::size_t position, const std::string& last_token,
+                     const nlohmann::detail::exception& ex) override;
+
+private:
+    enum Section { NONE, USERS, EDGES };
+    enum Field { F_ID, F_NAME, F_AGE, F_CITY, F_TAGS, F_EMAIL, F_PASSWORD, F_PIC, F_OTHER };
+
+    Graph& g;
+    int depth = 0;                 // contenedores abiertos
+    Section section = NONE;
+    Field field = F_OTHER;
+    unsigned seen = 0;             // campos del usuario actual (bit por Field)
+    uint64_t maxId = 0;
+
+    // Usuario en construcción
+    uint64_t id = 0;
+    int age = 0;
+    std::string name, city, email, password, profilePic;
+    std::vector<std::string> tags;
+
+    // Arista en construcción y lote pendiente
+    uint64_t pair[2] = {0, 0};
+    int pairLen = 0;
+    std::vector<std::pair<uint64_t, uint64_t>> batch;
+
+    bool integer(uint64_t v, bool negative);
+    void commitUser();
+    void flush();
+};
+
+#endif // JSON_STREAM_H
@@ -39,6 +39,11 @@ public:
      * @param key The key to insert.
      */
     void insert(int key);
+    /**
+     * @brief Inserts a key at the front without checking for duplicates.
+     * @param key The key to insert; the caller guarantees it is not present.
+     */
+    void insertUnique(int key);
     /**
      * @brief Removes the first occurrence of a key from the list.
      * @param key The key to remove.
@@ -0,0 +1,46 @@
+/**
+ * @file mapped_file.h
+ * @brief Defines MappedFile, a read-only memory mapping of a whole file.
+ */
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <cstddef>
+#include <string>
+
+/**
+ * @class MappedFile
+ * @brief RAII read-only mmap of a file; the contents stay valid while the object lives.
+ */
+class MappedFile {
+private:
+    const char* ptr;     // inicio del mapeo (nullptr si el archivo está vacío)
+    std::size_t len;     // bytes mapeados
+public:
+    /**
+     * @brief Maps a file into memory.
+     * @param path Path of the file to map.
+     * @throws std::runtime_error if the file cannot be opened or mapped.
+     */
+    explicit MappedFile(const std::string& path);
+    /**
+     * @brief Unmaps the file.
+     */
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @brief Returns the first byte of the file.
+     * @return Pointer to the mapped contents.
+     */
+    const char* data() const { return ptr; }
+    /**
+     * @brief Returns the file size.
+     * @return Number of mapped bytes.
+     */
+    std::size_t size() const { return len; }
+};
+
+#endif // MAPPED_FILE_H
@@ -0,0 +1,59 @@
+/**
+ * @file multi_bfs.h
+ * @brief Defines MultiSourceBfs, a bit-parallel BFS that runs up to 64 sources in one sweep.
+ */
+#ifndef MULTI_BFS_H
+#define MULTI_BFS_H
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+class CsrGraph;
+
+/**
+ * @class MultiSourceBfs
+ * @brief Breadth-first search from many sources at once using one bit per source.
+ *
+ * Every vertex holds a 64-bit "seen" mask and a frontier mask; bit i belongs
+ * to source i of the batch. Each level is one pass over the adjacency in which
+ * a vertex ORs its neighbors' frontier masks and keeps the bits it has not
+ * seen yet, so a batch of 64 BFSes costs about as much as a single BFS that
+ * goes as deep as the deepest of them. The pass is split across threads by
+ * vertex range (each vertex only writes its own masks). Longer source lists
+ * are processed in consecutive batches of LANES.
+ */
+class MultiSourceBfs {
+private:
+    const CsrGraph& g;
+    std::vector<uint64_t> seen, frontier, next;   // máscaras por vértice
+
+    void sweep(const uint32_t* sources, std::size_t count,
+               const std::function<void(uint32_t depth, const std::vector<uint64_t>& fresh)>& onLevel);
+public:
+    /// Sources per sweep (bits in a mask).
+    static constexpr std::size_t LANES = 64;
+
+    /**
+     * @brief Creates an engine bound to a snapshot.
+     * @param g Snapshot to traverse; must outlive the engine.
+     */
+    explicit MultiSourceBfs(const CsrGraph& g);
+
+    /**
+     * @brief Computes the eccentricity of every source (largest finite distance).
+     * @param sources Dense source indices.
+     * @return Eccentricity per source, in the same order.
+     */
+    std::vector<uint32_t> eccentricities(const std::vector<uint32_t>& sources);
+
+    /**
+     * @brief Computes all source × target hop distances.
+     * @param sources Dense source indices.
+     * @param targets Dense target indices.
+     * @return Row-major matrix: [i * targets.size() + j] = dist(sources[i], targets[j]), -1 if unreachable.
+     */
+    std::vector<int> distances(const std::vector<uint32_t>& sources, const std::vector<uint32_t>& targets);
+};
+
+#endif // MULTI_BFS_H
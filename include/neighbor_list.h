@@ -0,0 +1,110 @@
+/**
+ * @file neighbor_list.h
+ * @brief Defines NeighborList, a sorted small-vector of neighbor indices used as the mutable adjacency.
+ */
+#ifndef NEIGHBOR_LIST_H
+#define NEIGHBOR_LIST_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @class NeighborList
+ * @brief Sorted, duplicate-free set of dense vertex indices stored contiguously.
+ *
+ * Up to INLINE neighbors live inside the object itself (24 bytes in total),
+ * so low-degree users need no heap allocation at all. Larger lists move to
+ * one heap array that grows by doubling. Keeping the indices sorted makes
+ * contains() a binary search, lets insert() find its slot the same way, and
+ * lets snapshots copy each row without sorting it again.
+ */
+class NeighborList {
+private:
+    static const uint32_t INLINE = 4;
+    uint32_t count = 0;                  // vecinos almacenados
+    uint32_t cap = INLINE;               // capacidad (INLINE = almacenamiento interno)
+    union {
+        uint32_t inl[INLINE];            // vecinos en línea (grado bajo)
+        uint32_t* heap;                  // arreglo propio cuando cap > INLINE
+    };
+
+    bool isInline() const { return cap == INLINE; }
+    uint32_t* buffer() { return isInline() ? inl : heap; }
+    void grow(uint32_t need);            // asegura capacidad ≥ need
+public:
+    /**
+     * @brief Constructs an empty list (inline storage).
+     */
+    NeighborList() {}
+
+    /**
+     * @brief Frees the heap array, if any.
+     */
+    ~NeighborList();
+
+    NeighborList(const NeighborList& other);
+    NeighborList(NeighborList&& other) noexcept;
+    NeighborList& operator=(NeighborList other) noexcept;
+
+    /**
+     * @brief Returns the number of neighbors.
+     * @return List size.
+     */
+    std::size_t size() const { return count; }
+
+    /**
+     * @brief Checks whether the list is empty.
+     * @return true if there are no neighbors.
+     */
+    bool empty() const { return count == 0; }
+
+    /**
+     * @brief Returns the sorted neighbor indices.
+     * @return Pointer to size() contiguous indices.
+     */
+    const uint32_t* data() const { return isInline() ? inl : heap; }
+    const uint32_t* begin() const { return data(); }
+    const uint32_t* end() const { return data() + count; }
+    uint32_t operator[](std::size_t i) const { return data()[i]; }
+
+    /**
+     * @brief Checks membership with a binary search.
+     * @param v Dense index.
+     * @return true if v is in the list.
+     */
+    bool contains(uint32_t v) const;
+
+    /**
+     * @brief Inserts a neighbor at its sorted position.
+     * @param v Dense index.
+     * @return true if inserted, false if it was already present.
+     */
+    bool insert(uint32_t v);
+
+    /**
+     * @brief Removes a neighbor.
+     * @param v Dense index.
+     * @return true if it was present.
+     */
+    bool erase(uint32_t v);
+
+    /**
+     * @brief Merges a batch of new neighbors in one pass.
+     * @param vals Sorted indices, none of them already in the list.
+     * @param k Number of indices.
+     */
+    void mergeSorted(const uint32_t* vals, std::size_t k);
+
+    /**
+     * @brief Removes every neighbor and releases the heap array.
+     */
+    void clear();
+
+    /**
+     * @brief Returns the bytes held on the heap (0 while inline).
+     * @return Heap capacity in bytes.
+     */
+    std::size_t heapBytes() const { return isInline() ? 0 : cap * sizeof(uint32_t); }
+};
+
+#endif // NEIGHBOR_LIST_H
@@ -0,0 +1,38 @@
+/**
+ * @file parallel.h
+ * @brief Minimal std::thread helpers shared by the bulk-load and analytics code.
+ */
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+/**
+ * @brief Returns the number of worker threads to use (hardware concurrency, at least 1).
+ * @return Thread count.
+ */
+unsigned workerCount();
+
+/**
+ * @brief Splits [0, n) into contiguous chunks and runs body on each chunk in its own thread.
+ *
+ * The calling thread runs the first chunk; ranges shorter than the thread
+ * count use fewer threads.
+ * @param n Range size.
+ * @param body Callback receiving (begin, end, chunk index).
+ * @param threads Number of chunks (0 = workerCount()).
+ */
+void parallelFor(std::size_t n,
+                 const std::function<void(std::size_t, std::size_t, unsigned)>& body,
+                 unsigned threads = 0);
+
+/**
+ * @brief Sorts a vector of 64-bit keys: chunks are sorted in parallel, then merged pairwise.
+ * @param v Vector to sort in place.
+ */
+void parallelSort(std::vector<uint64_t>& v);
+
+#endif // PARALLEL_H
@@ -0,0 +1,66 @@
+/**
+ * @file path_finder.h
+ * @brief Defines PathFinder, a bidirectional BFS for point-to-point distances and routes.
+ */
+#ifndef PATH_FINDER_H
+#define PATH_FINDER_H
+
+#include <cstdint>
+#include <vector>
+
+class CsrGraph;
+
+/**
+ * @class PathFinder
+ * @brief Bidirectional breadth-first search over a CsrGraph with reusable scratch buffers.
+ *
+ * Each query grows one BFS level at a time from both endpoints, always
+ * expanding the side whose frontier has fewer outgoing edges, and stops at the
+ * first level where the two searches touch. Visited marks are epoch stamps, so
+ * the flat per-vertex arrays are allocated once and never cleared between
+ * queries. On small-world graphs this explores a tiny fraction of what a
+ * one-sided BFS does.
+ */
+class PathFinder {
+private:
+    // Por lado (0 = desde el origen, 1 = desde el destino)
+    std::vector<uint32_t> stamp[2];      // época en que se visitó el vértice
+    std::vector<uint32_t> dist[2];       // distancia al extremo de ese lado
+    std::vector<uint32_t> parent[2];     // predecesor en el árbol BFS de ese lado
+    std::vector<uint32_t> front[2];      // frontera actual
+    std::vector<uint32_t> next;          // frontera en construcción
+    uint32_t epoch = 0;
+    std::size_t visited = 0;             // vértices tocados en la última consulta
+
+    void prepare(uint32_t n);
+    uint32_t search(const CsrGraph& g, uint32_t src, uint32_t dst, int& hops);
+public:
+    /// Marker returned when the endpoints are not connected.
+    static constexpr uint32_t NONE = UINT32_MAX;
+
+    /**
+     * @brief Computes the hop distance between two vertices.
+     * @param g Graph snapshot.
+     * @param src Source dense index.
+     * @param dst Destination dense index.
+     * @return Number of hops, or -1 if unreachable.
+     */
+    int distance(const CsrGraph& g, uint32_t src, uint32_t dst);
+
+    /**
+     * @brief Computes one shortest route between two vertices.
+     * @param g Graph snapshot.
+     * @param src Source dense index.
+     * @param dst Destination dense index.
+     * @return Dense indices from src to dst inclusive, or empty if unreachable.
+     */
+    std::vector<uint32_t> path(const CsrGraph& g, uint32_t src, uint32_t dst);
+
+    /**
+     * @brief Returns how many vertices the last query visited (both sides).
+     * @return Visited vertex count.
+     */
+    std::size_t lastVisited() const { return visited; }
+};
+
+#endif // PATH_FINDER_H
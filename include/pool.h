@@ -0,0 +1,247 @@
+/**
+ * @file pool.h
+ * @brief Defines the slab allocator ObjectPool and the bump allocator Arena, with allocation counters.
+ */
+#ifndef POOL_H
+#define POOL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+/**
+ * @struct AllocStats
+ * @brief Counters kept by ObjectPool and Arena.
+ */
+struct AllocStats {
+    uint64_t allocations = 0;    ///< Objects / blocks handed out since creation.
+    uint64_t live = 0;           ///< Objects currently in use (pools) or since the last reset (arenas).
+    uint64_t bytesInUse = 0;     ///< Bytes of the live objects.
+    uint64_t bytesReserved = 0;  ///< Bytes obtained from the system (slabs / blocks).
+    uint64_t chunks = 0;         ///< Slabs or blocks currently held.
+};
+
+/**
+ * @class ObjectPool
+ * @brief Typed slab allocator: objects of one type carved from large slabs, recycled through a free list.
+ *
+ * create() constructs a T in a free slot (taking a new slab of SLAB_BYTES
+ * when none is left) and destroy() runs the destructor and pushes the slot on
+ * an intrusive free list, so steady-state churn never reaches the system
+ * allocator. The pool owns its objects: when it is destroyed (or assigned
+ * over), every object still alive is destructed and the slabs are released.
+ * Not thread-safe.
+ * @tparam T Object type.
+ */
+template <typename T>
+class ObjectPool {
+private:
+    union Slot {
+        Slot* next;                                // enlace de la lista libre
+        alignas(T) unsigned char obj[sizeof(T)];   // almacenamiento del objeto
+    };
+    static const std::size_t SLAB_BYTES = 64 * 1024;
+    static const std::size_t PER_SLAB = SLAB_BYTES / sizeof(Slot) ? SLAB_BYTES / sizeof(Slot) : 1;
+
+    std::vector<std::unique_ptr<Slot[]>> slabs;
+    Slot* freeList = nullptr;
+    std::size_t usedInSlab = PER_SLAB;             // ranuras entregadas del último slab
+    AllocStats st;
+
+    Slot* take() {
+        if (freeList) {
+            Slot* s = freeList;
+            freeList = s->next;
+            return s;
+        }
+        if (usedInSlab == PER_SLAB) {
+            slabs.emplace_back(new Slot[PER_SLAB]);
+            usedInSlab = 0;
+            st.bytesReserved += PER_SLAB * sizeof(Slot);
+            ++st.chunks;
+        }
+        return &slabs.back()[usedInSlab++];
+    }
+
+    /// Destruye los objetos vivos (los que no están en la lista libre) y suelta los slabs.
+    void release() {
+        if (!std::is_trivially_destructible<T>::value && st.live > 0) {
+            std::unordered_set<const Slot*> free;
+            for (const Slot* s = freeList; s; s = s->next) free.insert(s);
+            for (std::size_t i = 0; i < slabs.size(); ++i) {
+                std::size_t used = i + 1 == slabs.size() ? usedInSlab : PER_SLAB;
+                for (std::size_t j = 0; j < used; ++j)
+                    if (!free.count(&slabs[i][j])) reinterpret_cast<T*>(slabs[i][j].obj)->~T();
+            }
+        }
+        slabs.clear();
+        freeList = nullptr;
+        usedInSlab = PER_SLAB;
+        st = AllocStats();
+    }
+public:
+    ObjectPool() = default;
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+    ObjectPool(ObjectPool&& other) noexcept
+        : slabs(std::move(other.slabs)), freeList(other.freeList), usedInSlab(other.usedInSlab), st(other.st) {
+        other.freeList = nullptr;
+        other.usedInSlab = PER_SLAB;
+        other.st = AllocStats();
+    }
+    ObjectPool& operator=(ObjectPool&& other) noexcept {
+        if (this == &other) return *this;
+        release();
+        slabs = std::move(other.slabs);
+        freeList = other.freeList;
+        usedInSlab = other.usedInSlab;
+        st = other.st;
+        other.freeList = nullptr;
+        other.usedInSlab = PER_SLAB;
+        other.st = AllocStats();
+        return *this;
+    }
+
+    /**
+     * @brief Destroys the objects still alive and frees the slabs.
+     */
+    ~ObjectPool() { release(); }
+
+    /**
+     * @brief Constructs an object in a pooled slot.
+     * @param args Constructor arguments.
+     * @return Pointer to the new object (release it with destroy()).
+     */
+    template <typename... Args>
+    T* create(Args&&... args) {
+        Slot* s = take();
+        T* p;
+        try {
+            p = new (s->obj) T(std::forward<Args>(args)...);
+        } catch (...) {
+            s->next = freeList;
+            freeList = s;
+            throw;
+        }
+        ++st.allocations;
+        ++st.live;
+        st.bytesInUse += sizeof(T);
+        return p;
+    }
+
+    /**
+     * @brief Destroys an object created by this pool and recycles its slot.
+     * @param p Object pointer (nullptr is ignored).
+     */
+    void destroy(T* p) {
+        if (!p) return;
+        p->~T();
+        Slot* s = reinterpret_cast<Slot*>(p);
+        s->next = freeList;
+        freeList = s;
+        --st.live;
+        st.bytesInUse -= sizeof(T);
+    }
+
+    /**
+     * @brief Returns the pool's counters.
+     * @return Allocation statistics.
+     */
+    const AllocStats& stats() const { return st; }
+};
+
+/**
+ * @class Arena
+ * @brief Bump allocator for short-lived, trivially destructible objects freed all at once.
+ *
+ * Allocations advance a pointer inside the current block; a full block is
+ * followed by one twice as large, up to an optional cap (long-lived arenas
+ * cap it so the last block wastes little). Requests bigger than the next
+ * block get a block of their own. reset() forgets every object at once: it
+ * keeps only the largest block and rewinds it, so an arena reused for
+ * similar requests stops touching the system allocator after warm-up and
+ * each reset is O(1).
+ */
+class Arena {
+private:
+    std::vector<std::unique_ptr<unsigned char[]>> blocks;
+    std::size_t lastSize = 0;                      // tamaño del bloque actual
+    std::size_t largest = 0;                       // índice del bloque más grande
+    std::size_t largestSize = 0;                   // y su tamaño (el último puede ser menor)
+    std::size_t offset = 0;                        // bytes usados del bloque actual
+    std::size_t firstSize;                         // tamaño del primer bloque
+    std::size_t maxSize;                           // tope del crecimiento geométrico
+    AllocStats st;
+
+    void newBlock(std::size_t need);
+public:
+    /**
+     * @brief Creates an empty arena (no memory until the first allocation).
+     * @param firstBlock Size of the first block in bytes.
+     * @param maxBlock Largest block the arena grows to (bigger requests still fit).
+     */
+    explicit Arena(std::size_t firstBlock = 4096, std::size_t maxBlock = SIZE_MAX)
+        : firstSize(firstBlock), maxSize(maxBlock) {}
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+    Arena(Arena&& o) noexcept
+        : blocks(std::move(o.blocks)), lastSize(o.lastSize), largest(o.largest), largestSize(o.largestSize),
+          offset(o.offset), firstSize(o.firstSize), maxSize(o.maxSize), st(o.st) {
+        o.blocks.clear();
+        o.lastSize = o.largest = o.largestSize = o.offset = 0;
+        o.st = AllocStats();
+    }
+    Arena& operator=(Arena&& o) noexcept {
+        if (this == &o) return *this;
+        blocks = std::move(o.blocks);
+        lastSize = o.lastSize;
+        largest = o.largest;
+        largestSize = o.largestSize;
+        offset = o.offset;
+        firstSize = o.firstSize;
+        maxSize = o.maxSize;
+        st = o.st;
+        o.blocks.clear();
+        o.lastSize = o.largest = o.largestSize = o.offset = 0;
+        o.st = AllocStats();
+        return *this;
+    }
+
+    /**
+     * @brief Allocates raw memory from the current block.
+     * @param bytes Size in bytes.
+     * @param align Required alignment (power of two).
+     * @return Pointer valid until the next reset() or destruction.
+     */
+    void* allocate(std::size_t bytes, std::size_t align);
+
+    /**
+     * @brief Constructs an object in the arena.
+     * @param args Constructor arguments.
+     * @return Pointer valid until the next reset(); never freed individually.
+     */
+    template <typename T, typename... Args>
+    T* make(Args&&... args) {
+        static_assert(std::is_trivially_destructible<T>::value, "Arena no ejecuta destructores");
+        return new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Releases every object at once, keeping the largest block for reuse.
+     */
+    void reset();
+
+    /**
+     * @brief Returns the arena's counters.
+     * @return Allocation statistics.
+     */
+    const AllocStats& stats() const { return st; }
+};
+
+#endif // POOL_H
@@ -0,0 +1,173 @@
+/**
+ * @file post_store.h
+ * @brief Defines Post, Comment and PostStore, the post storage with stable IDs, a per-author
+ *        index and arena-backed text.
+ */
+#ifndef POST_STORE_H
+#define POST_STORE_H
+
+#include "pool.h"
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @struct Post
+ * @brief Represents a user's status update or post (fixed-size record).
+ *
+ * The text is a view into PostStore's text arena: it stays valid, also in
+ * copies of the record, for as long as the store (the Graph) lives.
+ */
+struct Post {
+    uint64_t id = 0;           ///< Unique post ID (assigned by PostStore, never reused).
+    uint64_t userId = 0;       ///< ID of the user who created the post.
+    std::string_view text;     ///< Content of the post (stored in the text arena).
+    std::time_t timestamp = 0; ///< Time when the post was created.
+    int likes = 0;             ///< Number of likes on the post.
+    uint32_t comments = 0;     ///< Number of comments (read them with PostStore::comments).
+};
+
+/**
+ * @struct Comment
+ * @brief One comment on a post (fixed-size record; text in the comment arena).
+ */
+struct Comment {
+    uint64_t postId = 0;       ///< Post the comment belongs to.
+    std::string_view text;     ///< Content of the comment.
+    std::time_t timestamp = 0; ///< Time when the comment was made.
+};
+
+/**
+ * @struct CommentPage
+ * @brief One page of a post's comments, oldest first, and the cursor to continue.
+ */
+struct CommentPage {
+    std::vector<Comment> comments;  ///< Comments of the page, oldest first.
+    uint64_t next = 0;              ///< Cursor for the following page.
+    bool more = false;              ///< true if the post has more comments after this page.
+};
+
+/**
+ * @struct PostStoreStats
+ * @brief Memory report of a PostStore.
+ */
+struct PostStoreStats {
+    uint64_t posts = 0;         ///< Stored posts.
+    uint64_t comments = 0;      ///< Stored comments.
+    uint64_t textBytes = 0;     ///< Bytes of post and comment text.
+    uint64_t arenaBytes = 0;    ///< Bytes reserved by the two text arenas.
+    uint64_t recordBytes = 0;   ///< Bytes reserved by post/comment records and the comment chains.
+    uint64_t indexBytes = 0;    ///< Approximate bytes of the per-author index.
+
+    /**
+     * @brief Returns the total footprint divided by the number of posts.
+     * @return Bytes per post (comments included), 0 if the store is empty.
+     */
+    double bytesPerPost() const {
+        return posts ? static_cast<double>(arenaBytes + recordBytes + indexBytes) / posts : 0.0;
+    }
+};
+
+/**
+ * @class PostStore
+ * @brief Append-only post storage addressed by monotonically increasing 64-bit IDs.
+ *
+ * Post IDs start at 1 and grow by one per add(), so the ID → slot lookup is a
+ * bounds-checked subtraction and like/comment are O(1). Each author also has
+ * the list of their post IDs in creation order (which is time order), so
+ * listing a user's posts reads one range instead of scanning every post.
+ *
+ * Text is never owned by the records: post and comment contents are appended
+ * to two arenas (large blocks that are never freed or moved), and the
+ * records keep a pointer and a length into them. A post or a comment is
+ * therefore one fixed-size record plus its bytes, with no allocation of its
+ * own. Comments live in a separate table, chained per post in creation
+ * order, and are read a page at a time.
+ */
+class PostStore {
+private:
+    static constexpr uint32_t NO_COMMENT = UINT32_MAX;
+
+    struct CommentRow {
+        Comment c;
+        uint32_t next = NO_COMMENT;          // siguiente comentario del mismo post
+    };
+    struct Chain {
+        uint32_t first = NO_COMMENT;         // primer y último comentario del post
+        uint32_t last = NO_COMMENT;
+    };
+
+    std::vector<Post> slots;                                        // post con ID i en slots[i - 1]
+    std::unordered_map<uint64_t, std::vector<uint64_t>> authorIndex; // autor → IDs, ascendentes
+    std::vector<CommentRow> commentRows;                            // en orden de creación
+    std::vector<Chain> chains;                                      // por post, paralelo a slots
+    Arena postText{64 * 1024, 1 << 20};                             // bytes de los posts
+    Arena commentText{16 * 1024, 1 << 20};                          // bytes de los comentarios
+
+    static std::string_view copyText(Arena& arena, std::string_view text);
+public:
+    /**
+     * @brief Stores a new post.
+     * @param author ID of the author.
+     * @param text Content (copied into the text arena).
+     * @param timestamp Creation time.
+     * @return The new post's ID.
+     */
+    uint64_t add(uint64_t author, std::string_view text, std::time_t timestamp);
+
+    /**
+     * @brief Looks up a post by ID.
+     * @param id Post ID.
+     * @return The post, or nullptr if the ID was never assigned.
+     */
+    Post* get(uint64_t id) { return id >= 1 && id <= slots.size() ? &slots[id - 1] : nullptr; }
+
+    /**
+     * @brief Looks up a post by ID (read-only).
+     * @param id Post ID.
+     * @return The post, or nullptr if the ID was never assigned.
+     */
+    const Post* get(uint64_t id) const { return id >= 1 && id <= slots.size() ? &slots[id - 1] : nullptr; }
+
+    /**
+     * @brief Returns an author's post IDs, oldest first.
+     * @param author ID of the author.
+     * @return Reference to the ID list (empty if the user never posted).
+     */
+    const std::vector<uint64_t>& byAuthor(uint64_t author) const;
+
+    /**
+     * @brief Appends a comment to a post.
+     * @param postId Post ID.
+     * @param text Content (copied into the comment arena).
+     * @param timestamp Creation time.
+     * @return false if the post does not exist.
+     */
+    bool addComment(uint64_t postId, std::string_view text, std::time_t timestamp);
+
+    /**
+     * @brief Returns one page of a post's comments, oldest first.
+     * @param postId Post ID.
+     * @param limit Maximum number of comments in the page.
+     * @param cursor 0 for the first page, otherwise CommentPage::next of the previous one.
+     * @return The page (empty if the post does not exist or has no more comments).
+     */
+    CommentPage comments(uint64_t postId, std::size_t limit, uint64_t cursor = 0) const;
+
+    /**
+     * @brief Returns the number of stored posts.
+     * @return Post count (also the last assigned ID).
+     */
+    std::size_t size() const { return slots.size(); }
+
+    /**
+     * @brief Reports the memory held by posts, comments and their text.
+     * @return Byte counts (see PostStoreStats::bytesPerPost).
+     */
+    PostStoreStats stats() const;
+};
+
+#endif // POST_STORE_H
@@ -7,8 +7,10 @@
 #define SUGGESTER_H
 
 #include "graph.h"
-#include "avl_tree.h"
+#include "top_k.h"
 #include <vector>
+#include <string>
+#include <unordered_set>
 #include <climits>
 
 /**
@@ -39,9 +41,19 @@ public:
      * @brief Counts the number of shared tags between two user profiles.
      * @param a ID of the first user.
      * @param b ID of the second user.
-     * @return Number of tags that both users share.
+     * @return Number of distinct tags that both users share.
      */
-    int commonTags(int a, int b) const;
+    int commonTags(uint64_t a, uint64_t b) const;
+
+    /**
+     * @brief Counts the tags a user shares with an already built tag set.
+     *
+     * Lets suggest() build the requesting user's set once per query.
+     * @param tagsA Tags of the first user.
+     * @param b ID of the second user.
+     * @return Number of distinct tags in both.
+     */
+    int commonTags(const std::unordered_set<std::string>& tagsA, uint64_t b) const;
 
     /**
      * @brief Constructs a Suggester instance for the given social graph.
@@ -51,12 +63,16 @@ public:
 
     /**
      * @brief Generates up to k friend suggestions for a user within a given radius.
+     *
+     * Search and mutual-friend buffers are per thread, so one Suggester can
+     * serve several threads while the graph is not mutated and its snapshot
+     * is current.
      * @param u The user ID for whom to generate suggestions.
      * @param k Maximum number of suggestions to return (default 5).
      * @param radius Maximum number of hops in BFS (default 3).
      * @return Vector of suggested user IDs ordered by score.
      */
-    std::vector<int> suggest(int u, int k = 5, int radius = 3) const;
+    std::vector<uint64_t> suggest(uint64_t u, int k = 5, int radius = 3) const;
 };
 
 #endif // SUGGESTER_H
\ No newline at end of file
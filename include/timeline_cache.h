@@ -0,0 +1,140 @@
+/**
+ * @file timeline_cache.h
+ * @brief Defines TimelineCache, bounded per-reader rings of post IDs for fan-out-on-write feeds.
+ */
+#ifndef TIMELINE_CACHE_H
+#define TIMELINE_CACHE_H
+
+#include "feed.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * @struct TimelineConfig
+ * @brief Tuning of the push-model timeline cache.
+ */
+struct TimelineConfig {
+    std::size_t capacity = 256;              ///< Post IDs kept per reader (older ones are dropped).
+    std::size_t celebrityThreshold = 5000;   ///< Audience (friends + followers) above which posts are pulled.
+};
+
+/**
+ * @struct TimelineStats
+ * @brief Counters of the timeline cache.
+ */
+struct TimelineStats {
+    uint64_t pushes = 0;          ///< Post IDs written into rings (write amplification).
+    uint64_t pulledPosts = 0;     ///< Posts not fanned out because their author is a celebrity.
+    uint64_t rebuilds = 0;        ///< Rings refilled from the pull path.
+    uint64_t bytes = 0;           ///< Memory held by the rings.
+};
+
+/**
+ * @class TimelineCache
+ * @brief Per-reader ring buffers of recent post IDs, indexed by dense user index.
+ *
+ * The owner pushes each new post into the rings of the author's audience and
+ * reads a feed page by merging a reader's ring with the few lists it still
+ * has to pull. A ring holds IDs in ascending order, so it is one more sorted
+ * run for mergeRuns. Rings start stale (and ignore pushes) until the owner
+ * refills them from the pull path, and are marked stale again whenever the
+ * reader's set of sources changes; readers that never read cost nothing on
+ * writes. Authors flagged as celebrities stay on the pull path for good.
+ */
+class TimelineCache {
+private:
+    struct Ring {
+        std::unique_ptr<uint64_t[]> ids;     // capacidad fija, circular
+        uint32_t start = 0;                  // posición del ID más antiguo
+        uint32_t count = 0;
+        bool dropped = false;                // se descartaron IDs antiguos
+        bool stale = true;                   // hay que reconstruirlo antes de leer
+    };
+    TimelineConfig cfg;
+    std::vector<Ring> rings;                 // por índice interno del lector
+    std::vector<char> celebrity;             // por índice interno del autor
+    TimelineStats st;
+
+    Ring& ring(uint32_t reader);
+public:
+    /**
+     * @brief Creates an empty cache.
+     * @param config Ring capacity and celebrity threshold.
+     */
+    explicit TimelineCache(const TimelineConfig& config) : cfg(config) {}
+
+    /**
+     * @brief Appends a post ID to a reader's ring (ignored while the ring is stale).
+     * @param reader Dense index of the reader.
+     * @param postId Post ID, larger than any already in the ring.
+     */
+    void push(uint32_t reader, uint64_t postId);
+
+    /**
+     * @brief Replaces a reader's ring and marks it fresh.
+     * @param reader Dense index of the reader.
+     * @param newestFirst Post IDs, newest first (only the first capacity are kept).
+     * @param complete false if older posts exist beyond the list.
+     */
+    void rebuild(uint32_t reader, const std::vector<uint64_t>& newestFirst, bool complete);
+
+    /**
+     * @brief Marks a reader's ring stale (its sources changed).
+     * @param reader Dense index of the reader.
+     */
+    void invalidate(uint32_t reader);
+
+    /**
+     * @brief Marks every ring stale (e.g. after a bulk edge load).
+     */
+    void invalidateAll();
+
+    /**
+     * @brief Checks whether a reader's ring can be read.
+     * @param reader Dense index of the reader.
+     * @return true if the ring is fresh.
+     */
+    bool fresh(uint32_t reader) const { return reader < rings.size() && !rings[reader].stale; }
+
+    /**
+     * @brief Returns the ring of a fresh reader as up to two ascending runs.
+     * @param reader Dense index of the reader.
+     * @param out Receives the runs.
+     * @return Smallest ID the ring is complete from (0 if nothing was ever dropped).
+     */
+    uint64_t runs(uint32_t reader, std::vector<PostRun>& out) const;
+
+    /**
+     * @brief Checks whether an author is on the pull path.
+     * @param author Dense index of the author.
+     * @return true if the author was flagged as a celebrity.
+     */
+    bool isCelebrity(uint32_t author) const { return author < celebrity.size() && celebrity[author]; }
+
+    /**
+     * @brief Flags an author as a celebrity (permanent).
+     * @param author Dense index of the author.
+     */
+    void markCelebrity(uint32_t author);
+
+    /**
+     * @brief Records a post that was left to the pull path.
+     */
+    void countPulled() { ++st.pulledPosts; }
+
+    /**
+     * @brief Returns the configuration.
+     * @return Capacity and threshold.
+     */
+    const TimelineConfig& config() const { return cfg; }
+
+    /**
+     * @brief Returns the counters.
+     * @return Cache statistics.
+     */
+    const TimelineStats& stats() const { return st; }
+};
+
+#endif // TIMELINE_CACHE_H
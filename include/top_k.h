@@ -0,0 +1,165 @@
+/**
+ * @file top_k.h
+ * @brief Defines TopK, a bounded selector of the k best (score, key) pairs.
+ */
+#ifndef TOP_K_H
+#define TOP_K_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+/**
+ * @class TopK
+ * @brief Keeps the k best entries of a stream in a min-heap of fixed capacity.
+ *
+ * The worst retained entry sits at the root, so each offer() is one
+ * comparison against it and, only when the new entry wins, one O(log k)
+ * sift. Higher scores are better; equal scores are ordered by TieBreak on
+ * the keys (by default the larger key wins, as in AVLTree). Up to INLINE
+ * entries live inside the object, so small selections never touch the heap;
+ * larger selections grow their storage as entries arrive, so a huge k costs
+ * only what is actually retained. Keys are not deduplicated. A TopK is not thread-safe: fill one per thread
+ * and combine them with merge().
+ * @tparam Score Score type (compared with <).
+ * @tparam Key Candidate identifier.
+ * @tparam TieBreak Strict order on keys; TieBreak(a, b) means a wins a tie.
+ * @tparam INLINE Capacity stored inline.
+ */
+template <typename Score, typename Key = uint32_t, typename TieBreak = std::greater<Key>,
+          std::size_t INLINE = 16>
+class TopK {
+public:
+    /// Retained candidate.
+    struct Entry {
+        Score score;  ///< Candidate score.
+        Key key;      ///< Candidate identifier.
+    };
+
+    /// Orden estricto "a es mejor que b".
+    struct Better {
+        bool operator()(const Entry& a, const Entry& b) const {
+            if (a.score < b.score) return false;
+            if (b.score < a.score) return true;
+            return TieBreak()(a.key, b.key);
+        }
+    };
+
+private:
+    std::array<Entry, INLINE> small;
+    std::vector<Entry> large;       // solo si k > INLINE; crece con las entradas
+    Entry* heap;                    // apunta a small o a large
+    std::size_t cap;
+    std::size_t n = 0;
+
+    void bind() { heap = cap > INLINE ? large.data() : small.data(); }
+
+public:
+    /**
+     * @brief Creates an empty selector.
+     * @param k Number of entries to keep (0 keeps nothing).
+     */
+    explicit TopK(std::size_t k) : cap(k) { bind(); }
+
+    TopK(const TopK& o) : small(o.small), large(o.large), cap(o.cap), n(o.n) { bind(); }
+    TopK(TopK&& o) noexcept : small(o.small), large(std::move(o.large)), cap(o.cap), n(o.n) {
+        bind();
+        o.cap = 0;
+        o.n = 0;
+        o.bind();
+    }
+    TopK& operator=(const TopK& o) {
+        if (this != &o) {
+            small = o.small;
+            large = o.large;
+            cap = o.cap;
+            n = o.n;
+            bind();
+        }
+        return *this;
+    }
+    TopK& operator=(TopK&& o) noexcept {
+        if (this != &o) {
+            small = o.small;
+            large = std::move(o.large);
+            cap = o.cap;
+            n = o.n;
+            bind();
+            o.cap = 0;
+            o.n = 0;
+            o.bind();
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Offers a candidate.
+     * @param score Candidate score.
+     * @param key Candidate identifier.
+     * @return true if the candidate is now among the retained entries.
+     */
+    bool offer(const Score& score, const Key& key) {
+        Entry e{score, key};
+        if (n < cap) {
+            if (cap > INLINE && n == large.size()) {    // reserva bajo demanda
+                large.push_back(e);
+                heap = large.data();
+            } else {
+                heap[n] = e;
+            }
+            ++n;
+            std::push_heap(heap, heap + n, Better());
+            return true;
+        }
+        if (cap == 0 || !Better()(e, heap[0])) return false;
+        std::pop_heap(heap, heap + n, Better());  // el peor pasa al final
+        heap[n - 1] = e;
+        std::push_heap(heap, heap + n, Better());
+        return true;
+    }
+
+    /**
+     * @brief Adds the entries of another selector (e.g. a partial result from another thread).
+     * @param other Selector to merge in; its capacity may differ.
+     */
+    void merge(const TopK& other) {
+        for (std::size_t i = 0; i < other.n; ++i) offer(other.heap[i].score, other.heap[i].key);
+    }
+
+    /**
+     * @brief Returns the worst retained entry, the bar a new candidate must beat once full.
+     * @return Root of the heap (size() must be > 0).
+     */
+    const Entry& worst() const { return heap[0]; }
+
+    /**
+     * @brief Returns the retained entries, best first.
+     * @return Sorted copy of the entries.
+     */
+    std::vector<Entry> sorted() const {
+        std::vector<Entry> out(heap, heap + n);
+        std::sort(out.begin(), out.end(), Better());
+        return out;
+    }
+
+    /**
+     * @brief Returns the retained keys, best first.
+     * @return Sorted keys.
+     */
+    std::vector<Key> keys() const {
+        std::vector<Key> out;
+        out.reserve(n);
+        for (const Entry& e : sorted()) out.push_back(e.key);
+        return out;
+    }
+
+    std::size_t size() const { return n; }           ///< Retained entries.
+    std::size_t capacity() const { return cap; }     ///< k.
+    bool full() const { return n == cap; }           ///< true once k entries are retained.
+    void clear() { n = 0; }                          ///< Empties the selector, keeping k.
+};
+
+#endif // TOP_K_H
@@ -0,0 +1,85 @@
+/**
+ * @file union_find.h
+ * @brief Defines UnionFind, a disjoint-set forest over dense vertex indices.
+ */
+#ifndef UNION_FIND_H
+#define UNION_FIND_H
+
+#include <cstdint>
+#include <vector>
+
+class CsrGraph;
+
+/**
+ * @class UnionFind
+ * @brief Disjoint-set forest with path halving and union by rank.
+ *
+ * Elements are dense vertex indices 0..size()-1 and start as singletons.
+ * unite compresses paths by halving and runs in amortized O(α(n)). Queries
+ * (root, connected) never write: union by rank keeps every tree O(log n)
+ * deep and rebuild() leaves them flat, so concurrent queries on a forest
+ * that is not being united are safe. merges() counts the
+ * successful unions, so the number of sets among k elements that were ever
+ * united is k - merges().
+ *
+ * rebuild() recomputes the forest from a CSR snapshot in parallel with
+ * lock-free compare-and-swap linking (roots are always hung below the smaller
+ * index, so concurrent links cannot form cycles) and leaves every tree flat.
+ */
+class UnionFind {
+private:
+    std::vector<uint32_t> parent;   // padre de cada elemento (raíz: a sí mismo)
+    std::vector<uint8_t> rnk;       // cota superior de la altura del árbol
+    uint32_t merged = 0;            // uniones exitosas
+
+    uint32_t find(uint32_t x);      // raíz con compresión por mitades (solo para unite)
+public:
+    /**
+     * @brief Extends the forest with singletons up to n elements.
+     * @param n New element count (no-op if not larger).
+     */
+    void grow(uint32_t n);
+
+    /**
+     * @brief Returns the number of elements.
+     * @return Element count.
+     */
+    uint32_t size() const { return static_cast<uint32_t>(parent.size()); }
+
+    /**
+     * @brief Returns the representative of x's set without modifying the forest.
+     * @param x Element (an index ≥ size() is its own singleton).
+     * @return Root of x's tree.
+     */
+    uint32_t root(uint32_t x) const;
+
+    /**
+     * @brief Merges the sets of a and b.
+     * @param a First element.
+     * @param b Second element.
+     * @return true if they were in different sets.
+     */
+    bool unite(uint32_t a, uint32_t b);
+
+    /**
+     * @brief Checks whether two elements are in the same set (read-only).
+     * @param a First element.
+     * @param b Second element.
+     * @return true if a and b share a root.
+     */
+    bool connected(uint32_t a, uint32_t b) const { return root(a) == root(b); }
+
+    /**
+     * @brief Returns the number of successful unions since the last reset.
+     * @return Merge count.
+     */
+    uint32_t merges() const { return merged; }
+
+    /**
+     * @brief Recomputes the forest from every edge of a snapshot, in parallel.
+     * @param g Snapshot whose vertices become the elements.
+     */
+    void rebuild(const CsrGraph& g);
+};
+
+#endif // UNION_FIND_H
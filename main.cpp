@@ -10,6 +10,7 @@
 #include <fstream>
 #include <nlohmann/json.hpp>
 #include <fstream>
+#include <chrono>
 
 /**
  * @brief Parses command-line arguments, initializes the social graph, and enters the user command loop.
@@ -31,10 +32,16 @@ int main(int argc, char* argv[]) {
     // --- Load graph and user profiles from CSV files ---
     Graph g;
     try {
-        g.loadCSV(csvPath);
+        CsvLoadStats es = g.loadCSV(csvPath);
+        std::cout << "Aristas: " << es.rows << " filas en " << es.seconds * 1e3 << " ms ("
+                  << static_cast<long long>(es.rowsPerSecond()) << " filas/s), "
+                  << es.malformed << " líneas inválidas\n";
         // Cargar perfiles de usuarios
         try {
-            g.loadUsersCSV("../data/users.csv");
+            CsvLoadStats us = g.loadUsersCSV("../data/users.csv");
+            std::cout << "Usuarios: " << us.rows << " filas ("
+                      << static_cast<long long>(us.rowsPerSecond()) << " filas/s), "
+                      << us.malformed << " líneas inválidas\n";
         } catch (const std::exception& ex) {
             std::cerr << ex.what() << std::endl;
         }
@@ -50,7 +57,7 @@ int main(int argc, char* argv[]) {
               << "  |  top-k=" << k << "  radius=" << radius << "\n";
 
     Suggester s(&g);
-    std::cout << "Comandos: k <valor>, radius <valor>, weights m t d, profile <id>, register, savejson <ruta>, loadjson <ruta>, export <uid> [ruta], stats (Ctrl+D para salir)\n";
+    std::cout << "Comandos: k <valor>, radius <valor>, weights m t d, profile <id>, path <a> <b>, register, savejson <ruta>, loadjson <ruta>, savebin <ruta>, loadbin <ruta>, export <uid> [ruta], top seguidores|likes [n], stats [--exact] (Ctrl+D para salir)\n";
     std::cout << "(Inicial k=" << k << ", radius=" << radius << ")\n";
 
     // --- Main command processing loop ---
@@ -60,12 +67,47 @@ int main(int argc, char* argv[]) {
         if (!std::getline(std::cin, line)) break;   // EOF = salir
 
         // --- Command: stats (show global metrics) ---
-        if (line == "stats") {
+        if (line == "stats" || line == "stats --exact") {
             std::cout << "Vértices: " << g.numVertices()
                       << ", Aristas: " << g.numEdges() << "\n";
+            std::cout << "Componentes: " << g.componentCount() << "\n";
             std::cout << "Grado promedio: " << g.averageDegree() << "\n";
             std::cout << "Diámetro aprox.: " << g.approximateDiameter() << "\n";
+            if (line == "stats --exact") {
+                auto t0 = std::chrono::steady_clock::now();
+                DiameterStats d = g.exactDiameter();
+                double ms = std::chrono::duration<double, std::milli>(
+                    std::chrono::steady_clock::now() - t0).count();
+                std::cout << "Diámetro exacto: " << d.diameter << " (" << d.bfsRuns
+                          << " BFS en " << d.sweeps << " recorridos, " << ms << " ms)\n";
+            }
             std::cout << "Clustering medio: " << g.averageClusteringCoefficient() << "\n";
+            std::cout << "Triángulos: " << g.triangleCount()
+                      << ", Transitividad: " << g.transitivity() << "\n";
+            PostStoreStats ps = g.postStats();
+            std::cout << "Posts: " << ps.posts << ", Comentarios: " << ps.comments
+                      << ", Bytes por post: " << ps.bytesPerPost() << "\n";
+            continue;
+        }
+
+        // --- Command: top seguidores|likes [n] (live leaderboards) ---
+        if (line.rfind("top ", 0) == 0) {
+            std::stringstream ss(line.substr(4));
+            std::string board;
+            int n = 10;
+            ss >> board;
+            if (!(ss >> n)) n = 10;
+            if (board != "seguidores" && board != "likes") {
+                std::cout << "Uso: top seguidores|likes [n]\n";
+                continue;
+            }
+            auto rows = board == "seguidores" ? g.mostFollowed(n) : g.mostLiked(n);
+            if (rows.empty()) std::cout << "Ranking vacío.\n";
+            for (size_t i = 0; i < rows.size(); ++i) {
+                User* u = g.getUser(rows[i].first);
+                std::cout << i + 1 << ". " << (u ? u->name : std::to_string(rows[i].first))
+                          << " (" << rows[i].first << "): " << rows[i].second << " " << board << "\n";
+            }
             continue;
         }
 
@@ -73,10 +115,9 @@ int main(int argc, char* argv[]) {
         if (line.rfind("savejson ", 0) == 0) {
             std::string path = line.substr(9);
             try {
-                auto j = g.toJson();
                 std::ofstream ofs(path);
                 if (!ofs) throw std::runtime_error("No se pudo abrir: " + path);
-                ofs << j.dump(4);
+                g.writeJson(ofs);
                 std::cout << "Guardado JSON en \"" << path << "\"\n";
             } catch (const std::exception& e) {
                 std::cout << "Error al guardar JSON: " << e.what() << "\n";
@@ -90,9 +131,7 @@ int main(int argc, char* argv[]) {
             try {
                 std::ifstream ifs(path);
                 if (!ifs) throw std::runtime_error("No se pudo abrir: " + path);
-                nlohmann::json j;
-                ifs >> j;
-                g = Graph::fromJson(j);
+                g = Graph::readJson(ifs);
                 std::cout << "Cargado red desde JSON \"" << path << "\"\n";
             } catch (const std::exception& e) {
                 std::cout << "Error al cargar JSON: " << e.what() << "\n";
@@ -100,10 +139,37 @@ int main(int argc, char* argv[]) {
             continue;
         }
 
+        // --- Command: savebin <path> (write binary snapshot) ---
+        if (line.rfind("savebin ", 0) == 0) {
+            std::string path = line.substr(8);
+            try {
+                g.saveBinary(path);
+                std::cout << "Guardado snapshot binario en \"" << path << "\"\n";
+            } catch (const std::exception& e) {
+                std::cout << "Error al guardar snapshot: " << e.what() << "\n";
+            }
+            continue;
+        }
+
+        // --- Command: loadbin <path> (map binary snapshot) ---
+        if (line.rfind("loadbin ", 0) == 0) {
+            std::string path = line.substr(8);
+            try {
+                auto t0 = std::chrono::steady_clock::now();
+                g = Graph::loadBinary(path);
+                double ms = std::chrono::duration<double, std::milli>(
+                    std::chrono::steady_clock::now() - t0).count();
+                std::cout << "Cargado snapshot binario \"" << path << "\" en " << ms << " ms\n";
+            } catch (const std::exception& e) {
+                std::cout << "Error al cargar snapshot: " << e.what() << "\n";
+            }
+            continue;
+        }
+
         // --- Command: export <uid> [path] (export suggestions to CSV) ---
         if (line.rfind("export ", 0) == 0) {
             std::stringstream ss(line.substr(7));
-            int uid;
+            uint64_t uid;
             std::string outPath;
             ss >> uid;
             if (!(ss >> outPath)) {
@@ -115,7 +181,7 @@ int main(int argc, char* argv[]) {
                 std::cout << "No se pudo abrir archivo: " << outPath << "\n";
             } else {
                 ofs << "recommendation_id,name,age,city\n";
-                for (int v : recs) {
+                for (uint64_t v : recs) {
                     User* prof = g.getUser(v);
                     std::string vName = prof ? prof->name : std::to_string(v);
                     int vAge = prof ? prof->age : 0;
@@ -162,7 +228,7 @@ int main(int argc, char* argv[]) {
         // --- Command: profile <id> (show user profile) ---
         if (line.rfind("profile ", 0) == 0) {   // muestra perfil
             try {
-                int pid = std::stoi(line.substr(8));
+                uint64_t pid = std::stoull(line.substr(8));
                 User* uProf = g.getUser(pid);
                 if (!uProf) {
                     std::cout << "Usuario " << pid << " no encontrado.\n";
@@ -183,6 +249,29 @@ int main(int argc, char* argv[]) {
             continue;
         }
 
+        // --- Command: path <a> <b> (how two users are connected) ---
+        if (line.rfind("path ", 0) == 0) {
+            std::stringstream ss(line.substr(5));
+            uint64_t a, b;
+            if (!(ss >> a >> b)) {
+                std::cout << "Uso: path <a> <b>\n";
+                continue;
+            }
+            std::vector<uint64_t> route = g.shortestPathRoute(a, b);
+            if (route.empty()) {
+                std::cout << "No hay conexión entre " << a << " y " << b << ".\n";
+                continue;
+            }
+            for (size_t i = 0; i < route.size(); ++i) {
+                if (i) std::cout << " -> ";
+                User* u = g.getUser(route[i]);
+                if (u) std::cout << u->name << " (" << route[i] << ")";
+                else std::cout << route[i];
+            }
+            std::cout << "  [" << route.size() - 1 << " saltos]\n";
+            continue;
+        }
+
         // --- Command: register (interactive user registration) ---
         if (line == "register") {
             // --- Solicitar nombre ---
@@ -229,7 +318,7 @@ int main(int argc, char* argv[]) {
             if (pwd.empty()) { std::cout << "Contraseña inválida.\n"; continue; }
 
             // --- Crear usuario ---
-            int newId = g.nextUserId();
+            uint64_t newId = g.nextUserId();
             // --- Email para registro ---
             std::string email;
             std::cout << "Email: ";
@@ -252,8 +341,8 @@ int main(int argc, char* argv[]) {
             continue;
         }
 
-        int uid;
-        try { uid = std::stoi(line); }
+        uint64_t uid;
+        try { uid = std::stoull(line); }
         catch (...) { std::cout << "Comando desconocido\n"; continue; }
 
         auto recs = s.suggest(uid, k, radius);
@@ -264,7 +353,7 @@ int main(int argc, char* argv[]) {
             std::cout << "No hay sugerencias para " << curName << "\n";
         } else {
             std::cout << "Sugerencias para " << curName << ":\n";
-            for (int v : recs) {
+            for (uint64_t v : recs) {
                 User* prof = g.getUser(v);
                 std::string vName = prof ? prof->name : std::to_string(v);
                 if (prof) {
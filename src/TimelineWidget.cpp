@@ -12,14 +12,17 @@ TimelineWidget::TimelineWidget(Graph& graph, uint64_t userId, QWidget* parent)
     postEdit = new QTextEdit(this);
     postButton = new QPushButton("Publicar", this);
     postList = new QListWidget(this);
+    moreButton = new QPushButton("Ver más", this);
 
     // Assemble layout
     mainLayout->addWidget(postEdit);
     mainLayout->addWidget(postButton);
     mainLayout->addWidget(postList);
+    mainLayout->addWidget(moreButton);
 
-    // Connect button
+    // Connect buttons
     connect(postButton, &QPushButton::clicked, this, &TimelineWidget::onPost);
+    connect(moreButton, &QPushButton::clicked, this, &TimelineWidget::loadMore);
 
     // Initial load
     refresh();
@@ -36,57 +39,58 @@ void TimelineWidget::onPost() {
 
 void TimelineWidget::refresh() {
     postList->clear();
-    auto userPosts = g.getFeed(userId);
+    cursor = 0;
+    loadMore();
+}
 
-    // Sort posts by most recent first
-    std::sort(userPosts.begin(), userPosts.end(),
-              [](const Post& a, const Post& b) {
-                  return a.timestamp > b.timestamp;
-              });
+void TimelineWidget::loadMore() {
+    // La página ya llega ordenada, del post más reciente al más antiguo, sin copias
+    cursor = g.forEachFeedPost(userId, PAGE_SIZE, [this](const Post& p) { addPostItem(p); }, cursor);
+    moreButton->setEnabled(cursor != 0);
+}
 
-    for (const auto& p : userPosts) {
-        QDateTime dt = QDateTime::fromSecsSinceEpoch(p.timestamp);
-        // Build display text with author
-        User* author = g.getUser(p.userId);
-        QString authorName = author ? QString::fromStdString(author->name) : QString("Unknown");
-        QString content = dt.toString("yyyy-MM-dd hh:mm:ss") + " [" + authorName + "] " + 
-                          QString::fromStdString(p.text);
+void TimelineWidget::addPostItem(const Post& p) {
+    QDateTime dt = QDateTime::fromSecsSinceEpoch(p.timestamp);
+    // Build display text with author
+    User* author = g.getUser(p.userId);
+    QString authorName = author ? QString::fromStdString(author->name) : QString("Unknown");
+    QString content = dt.toString("yyyy-MM-dd hh:mm:ss") + " [" + authorName + "] " + 
+                      QString::fromUtf8(p.text.data(), static_cast<int>(p.text.size()));
 
-        // Create list item and container widget
-        QListWidgetItem* item = new QListWidgetItem(postList);
-        QWidget* container = new QWidget(postList);
-        QHBoxLayout* hLayout = new QHBoxLayout(container);
+    // Create list item and container widget
+    QListWidgetItem* item = new QListWidgetItem(postList);
+    QWidget* container = new QWidget(postList);
+    QHBoxLayout* hLayout = new QHBoxLayout(container);
 
-        // Label for content
-        QLabel* label = new QLabel(content, container);
-        hLayout->addWidget(label);
+    // Label for content
+    QLabel* label = new QLabel(content, container);
+    hLayout->addWidget(label);
 
-        // Like button
-        QPushButton* likeBtn = new QPushButton(QString("👍 %1").arg(p.likes), container);
-        connect(likeBtn, &QPushButton::clicked, this, [this, p]() {
-            g.likePost(p.userId, p.timestamp);
-            refresh();
-        });
-        hLayout->addWidget(likeBtn);
+    // Like button
+    QPushButton* likeBtn = new QPushButton(QString("👍 %1").arg(p.likes), container);
+    connect(likeBtn, &QPushButton::clicked, this, [this, postId = p.id]() {
+        g.likePost(postId);
+        refresh();
+    });
+    hLayout->addWidget(likeBtn);
 
-        // Comment button
-        QPushButton* commentBtn = new QPushButton("💬", container);
-        connect(commentBtn, &QPushButton::clicked, this, [this, p]() {
-            bool ok;
-            QString cm = QInputDialog::getText(this, "Comentario", "Tu comentario:", QLineEdit::Normal, "", &ok);
-            if (ok && !cm.trimmed().isEmpty()) {
-                g.addComment(p.userId, p.timestamp, cm.toStdString());
-                refresh();
-            }
-        });
-        hLayout->addWidget(commentBtn);
+    // Comment button
+    QPushButton* commentBtn = new QPushButton(QString("💬 %1").arg(p.comments), container);
+    connect(commentBtn, &QPushButton::clicked, this, [this, postId = p.id]() {
+        bool ok;
+        QString cm = QInputDialog::getText(this, "Comentario", "Tu comentario:", QLineEdit::Normal, "", &ok);
+        if (ok && !cm.trimmed().isEmpty()) {
+            g.addComment(postId, cm.toStdString());
+            refresh();
+        }
+    });
+    hLayout->addWidget(commentBtn);
 
-        // Set layout margins to zero
-        hLayout->setContentsMargins(0,0,0,0);
+    // Set layout margins to zero
+    hLayout->setContentsMargins(0,0,0,0);
 
-        // Assign widget to item
-        container->setLayout(hLayout);
-        postList->setItemWidget(item, container);
-        item->setSizeHint(container->sizeHint());
-    }
-}
\ No newline at end of file
+    // Assign widget to item
+    container->setLayout(hLayout);
+    postList->setItemWidget(item, container);
+    item->setSizeHint(container->sizeHint());
+}
@@ -6,24 +6,58 @@
 #include <algorithm>
 
 /**
- * @brief Constructs an empty AVLTree.
+ * @brief Constructs an empty AVLTree with its own arena.
  */
-AVLTree::AVLTree() : root(nullptr) {}
+AVLTree::AVLTree() : root(nullptr), arena(&own) {}
 
 /**
- * @brief Destroys the AVLTree and frees all allocated nodes.
+ * @brief Constructs an empty AVLTree on a caller-owned arena.
+ * @param scratch Arena that holds the nodes.
  */
-AVLTree::~AVLTree() { destroy(root); }
+AVLTree::AVLTree(Arena& scratch) : root(nullptr), own(0), arena(&scratch) {}
 
 /**
- * @brief Recursively destroys the subtree rooted at a node.
- * @param node The root of the subtree to destroy.
+ * @brief Releases all nodes at once: the own arena frees its blocks, a shared one is rewound.
  */
-void AVLTree::destroy(AVLNode* node) {
-    if (!node) return;
-    destroy(node->left);
-    destroy(node->right);
-    delete node;
+AVLTree::~AVLTree() {
+    if (arena != &own) arena->reset();
+}
+
+/**
+ * @brief Moves the nodes, the index and the arena binding of another tree.
+ * @param other Tree left empty (on its own arena).
+ */
+AVLTree::AVLTree(AVLTree&& other) noexcept
+    : root(other.root), own(std::move(other.own)),
+      arena(other.arena == &other.own ? &own : other.arena),
+      freeNodes(other.freeNodes), index(std::move(other.index)) {
+    other.root = nullptr;
+    other.arena = &other.own;
+    other.freeNodes = nullptr;
+    other.index.clear();
+}
+
+/**
+ * @brief Releases the current nodes, then moves another tree in.
+ *
+ * If both trees share a caller arena it is not rewound, since other's
+ * nodes live there too; this tree's old nodes stay until the arena resets.
+ * @param other Tree left empty (on its own arena).
+ * @return This tree.
+ */
+AVLTree& AVLTree::operator=(AVLTree&& other) noexcept {
+    if (this == &other) return *this;
+    if (arena != &own && arena != other.arena) arena->reset();
+    root = other.root;
+    own = std::move(other.own);
+    arena = other.arena == &other.own ? &own : other.arena;
+    freeNodes = other.freeNodes;
+    index = std::move(other.index);
+    other.root = nullptr;
+    other.arena = &other.own;
+    other.freeNodes = nullptr;
+    other.index.clear();
+    return *this;
 }
 
 /**
@@ -36,8 +70,8 @@ AVLNode* AVLTree::rotateRight(AVLNode* y) {
     AVLNode* T2 = x->right;
     x->right = y;
     y->left = T2;
-    y->height = std::max(h(y->left), h(y->right)) + 1;
-    x->height = std::max(h(x->left), h(x->right)) + 1;
+    pull(y);
+    pull(x);
     return x;
 }
 
@@ -51,8 +85,8 @@ AVLNode* AVLTree::rotateLeft(AVLNode* x) {
     AVLNode* T2 = y->left;
     y->left = x;
     x->right = T2;
-    x->height = std::max(h(x->left), h(x->right)) + 1;
-    y->height = std::max(h(y->left), h(y->right)) + 1;
+    pull(x);
+    pull(y);
     return y;
 }
 
@@ -69,6 +103,40 @@ bool AVLTree::isLess(int s1, int u1, int s2, int u2) const {
     return u1 < u2;                          // empate por ID
 }
 
+/**
+ * @brief Recomputes height and size of a node and restores the AVL balance.
+ * @param node Subtree root whose children are already balanced.
+ * @return New subtree root.
+ */
+AVLNode* AVLTree::rebalance(AVLNode* node) {
+    pull(node);
+    int bf = balance(node);
+    // LL / LR
+    if (bf > 1) {
+        if (balance(node->left) < 0) node->left = rotateLeft(node->left);
+        return rotateRight(node);
+    }
+    // RR / RL
+    if (bf < -1) {
+        if (balance(node->right) > 0) node->right = rotateRight(node->right);
+        return rotateLeft(node);
+    }
+    return node;
+}
+
+/**
+ * @brief Takes a node from the free list, or a new one from the arena.
+ * @param user User ID.
+ * @param score Score.
+ * @return Fresh leaf node.
+ */
+AVLNode* AVLTree::newNode(int user, int score) {
+    if (!freeNodes) return arena->make<AVLNode>(user, score);
+    AVLNode* n = freeNodes;
+    freeNodes = n->right;
+    return new (n) AVLNode(user, score);
+}
+
 /**
  * @brief Inserts a user-score pair into the subtree rooted at node.
  * @param node Current subtree root.
@@ -77,7 +145,7 @@ bool AVLTree::isLess(int s1, int u1, int s2, int u2) const {
  * @return New subtree root after insertion and balancing.
  */
 AVLNode* AVLTree::insert(AVLNode* node, int user, int score) {
-    if (!node) return new AVLNode(user, score);
+    if (!node) return newNode(user, score);
 
     if (isLess(score, user, node->score, node->user))
         node->left = insert(node->left, user, score);
@@ -86,38 +154,141 @@ AVLNode* AVLTree::insert(AVLNode* node, int user, int score) {
     else
         return node; // duplicado
 
-    node->height = std::max(h(node->left), h(node->right)) + 1;
-    int bf = balance(node);
+    return rebalance(node);
+}
 
-    // LL
-    if (bf > 1 && isLess(score, user, node->left->score, node->left->user))
-        return rotateRight(node);
-    // RR
-    if (bf < -1 && isLess(node->right->score, node->right->user, score, user))
-        return rotateLeft(node);
-    // LR
-    if (bf > 1 && isLess(node->left->score, node->left->user, score, user)) {
-        node->left = rotateLeft(node->left);
-        return rotateRight(node);
-    }
-    // RL
-    if (bf < -1 && isLess(score, user, node->right->score, node->right->user)) {
-        node->right = rotateRight(node->right);
-        return rotateLeft(node);
-    }
+/**
+ * @brief Removes a user-score pair from the subtree rooted at node.
+ * @param node Current subtree root.
+ * @param user User ID to remove.
+ * @param score Its current score (the node key).
+ * @return New subtree root after removal and balancing.
+ */
+AVLNode* AVLTree::erase(AVLNode* node, int user, int score) {
+    if (!node) return nullptr;
 
-    return node;
+    if (isLess(score, user, node->score, node->user)) {
+        node->left = erase(node->left, user, score);
+    } else if (isLess(node->score, node->user, score, user)) {
+        node->right = erase(node->right, user, score);
+    } else if (!node->left || !node->right) {
+        AVLNode* child = node->left ? node->left : node->right;
+        node->right = freeNodes;            // a la lista libre
+        freeNodes = node;
+        return child;
+    } else {
+        // dos hijos: el sucesor (mínimo del subárbol derecho) ocupa su lugar
+        AVLNode* succ = node->right;
+        while (succ->left) succ = succ->left;
+        node->user = succ->user;
+        node->score = succ->score;
+        node->right = erase(node->right, succ->user, succ->score);
+    }
+    return rebalance(node);
 }
 
 /**
- * @brief Inserts a user and score into the AVL tree.
+ * @brief Inserts a user and score into the AVL tree, replacing the user's previous score.
  * @param user The user ID.
  * @param score The score for the user.
  */
 void AVLTree::insert(int user, int score) {
+    auto it = index.find(user);
+    if (it != index.end()) {
+        if (it->second == score) return;
+        root = erase(root, user, it->second);
+        it->second = score;
+    } else {
+        index.emplace(user, score);
+    }
     root = insert(root, user, score);
 }
 
+/**
+ * @brief Moves an existing user to a new score.
+ * @param user The user ID.
+ * @param newScore New score.
+ * @return false if the user is not in the tree.
+ */
+bool AVLTree::update(int user, int newScore) {
+    if (!contains(user)) return false;
+    insert(user, newScore);
+    return true;
+}
+
+/**
+ * @brief Removes a user and recycles its node.
+ * @param user The user ID.
+ * @return false if the user is not in the tree.
+ */
+bool AVLTree::erase(int user) {
+    auto it = index.find(user);
+    if (it == index.end()) return false;
+    root = erase(root, user, it->second);
+    index.erase(it);
+    return true;
+}
+
+/**
+ * @brief Looks up a user's score in the index.
+ * @param user The user ID.
+ * @return The score, or 0 if absent.
+ */
+int AVLTree::score(int user) const {
+    auto it = index.find(user);
+    return it == index.end() ? 0 : it->second;
+}
+
+/**
+ * @brief Counts the entries above a user along the path to its node.
+ * @param user The user ID.
+ * @return 1-based rank from the top, or -1 if absent.
+ */
+int AVLTree::rank(int user) const {
+    auto it = index.find(user);
+    if (it == index.end()) return -1;
+    int s = it->second;
+    int above = 0;
+    AVLNode* n = root;
+    while (n) {
+        if (isLess(s, user, n->score, n->user)) {
+            above += sz(n->right) + 1;      // n y su subárbol derecho van antes
+            n = n->left;
+        } else if (isLess(n->score, n->user, s, user)) {
+            n = n->right;
+        } else {
+            return above + sz(n->right) + 1;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Collects, in descending order, the users of a subtree with score in [lo, hi].
+ * @param node Current subtree root.
+ * @param lo Minimum score.
+ * @param hi Maximum score.
+ * @param out Vector receiving user IDs.
+ */
+void AVLTree::rangeDesc(AVLNode* node, int lo, int hi, std::vector<int>& out) const {
+    if (!node) return;
+    if (node->score <= hi) rangeDesc(node->right, lo, hi, out);   // a la derecha puede haber iguales
+    if (node->score >= lo && node->score <= hi) out.push_back(node->user);
+    if (node->score >= lo) rangeDesc(node->left, lo, hi, out);
+}
+
+/**
+ * @brief Returns the users with score in [lo, hi], highest first.
+ * @param lo Minimum score (inclusive).
+ * @param hi Maximum score (inclusive).
+ * @return User IDs in descending score order.
+ */
+std::vector<int> AVLTree::range(int lo, int hi) const {
+    std::vector<int> res;
+    rangeDesc(root, lo, hi, res);
+    return res;
+}
+
 /**
  * @brief Performs reverse in-order traversal to collect top-k users.
  * @param node Current subtree root.
@@ -141,7 +312,7 @@ void AVLTree::inorderDesc(AVLNode* node, int k, int& count, std::vector<int>& ou
  * @return Vector of user IDs with highest scores.
  */
 std::vector<int> AVLTree::topK(int k) const {
-    std::vector<int> res; res.reserve(k);
+    std::vector<int> res; res.reserve(std::max(0, std::min(k, size())));
     int cnt = 0;
     inorderDesc(root, k, cnt, res);
     return res;
@@ -0,0 +1,178 @@
+/**
+ * @file bfs_engine.cpp
+ * @brief Implements the direction-optimizing parallel BFS engine.
+ */
+#include "../include/bfs_engine.h"
+#include "../include/csr_graph.h"
+#include "../include/parallel.h"
+
+namespace {
+
+/// Por debajo de este trabajo por paso no compensa lanzar hilos.
+const uint64_t PARALLEL_WORK = 1u << 15;
+
+} // namespace
+
+/**
+ * @brief Sizes the buffers for g and clears what the previous run touched.
+ * @param g Graph snapshot about to be traversed.
+ */
+void BfsEngine::prepare(const CsrGraph& g) {
+    std::size_t words = (static_cast<std::size_t>(g.numVertices()) + 63) / 64;
+    if (g.numVertices() != n || !seen) {
+        n = g.numVertices();
+        dist.assign(n, -1);
+        par.resize(n);
+        seen.reset(new std::atomic<uint64_t>[words ? words : 1]);
+        for (std::size_t w = 0; w < words; ++w) seen[w].store(0, std::memory_order_relaxed);
+        frontBits.assign(words, 0);
+    } else {
+        for (uint32_t v : visitOrder) {           // limpiar solo lo tocado
+            dist[v] = -1;
+            seen[v >> 6].store(0, std::memory_order_relaxed);
+        }
+    }
+    visitOrder.clear();
+    levelStart.assign(1, 0);
+    bottomUpSteps = 0;
+}
+
+/**
+ * @brief Expands frontier order()[b, e) by scanning its edges.
+ * @return Sum of the degrees of the newly reached vertices.
+ */
+uint64_t BfsEngine::topDown(const CsrGraph& g, std::size_t b, std::size_t e, int depth, unsigned threads) {
+    std::vector<uint64_t> edges(threads, 0);
+    parallelFor(e - b, [&](std::size_t lo, std::size_t hi, unsigned t) {
+        std::vector<uint32_t>& out = local[t];
+        uint64_t sum = 0;
+        for (std::size_t i = b + lo; i < b + hi; ++i) {
+            uint32_t u = visitOrder[i];
+            for (uint32_t w : g.neighbors(u)) {
+                uint64_t bit = 1ULL << (w & 63);
+                std::atomic<uint64_t>& word = seen[w >> 6];
+                if (word.load(std::memory_order_relaxed) & bit) continue;
+                if (word.fetch_or(bit, std::memory_order_relaxed) & bit) continue;   // otro hilo ganó
+                dist[w] = depth;
+                par[w] = u;
+                out.push_back(w);
+                sum += g.degree(w);
+            }
+        }
+        edges[t] = sum;
+    }, threads);
+    uint64_t total = 0;
+    for (uint64_t s : edges) total += s;
+    return total;
+}
+
+/**
+ * @brief Lets every unvisited vertex look for a parent in the frontier bitmap.
+ * @return Sum of the degrees of the newly reached vertices.
+ */
+uint64_t BfsEngine::bottomUp(const CsrGraph& g, int depth, unsigned threads) {
+    std::size_t words = frontBits.size();
+    std::vector<uint64_t> edges(threads, 0);
+    parallelFor(words, [&](std::size_t lo, std::size_t hi, unsigned t) {
+        std::vector<uint32_t>& out = local[t];
+        uint64_t sum = 0;
+        for (std::size_t wi = lo; wi < hi; ++wi) {
+            // Cada hilo es dueño de sus palabras del bitmap: no hacen falta operaciones atómicas
+            uint64_t s = seen[wi].load(std::memory_order_relaxed), found = 0;
+            uint64_t todo = ~s;
+            if (wi == words - 1 && (n & 63)) todo &= (1ULL << (n & 63)) - 1;
+            for (; todo; todo &= todo - 1) {
+                uint32_t v = static_cast<uint32_t>(wi * 64 + __builtin_ctzll(todo));
+                for (uint32_t u : g.neighbors(v)) {
+                    if (!((frontBits[u >> 6] >> (u & 63)) & 1)) continue;
+                    found |= todo & (~todo + 1);
+                    dist[v] = depth;
+                    par[v] = u;
+                    out.push_back(v);
+                    sum += g.degree(v);
+                    break;
+                }
+            }
+            if (found) seen[wi].store(s | found, std::memory_order_relaxed);
+        }
+        edges[t] = sum;
+    }, threads);
+    uint64_t total = 0;
+    for (uint64_t s : edges) total += s;
+    return total;
+}
+
+/**
+ * @brief Runs a BFS from one source.
+ * @param g Graph snapshot.
+ * @param src Source dense index.
+ * @param maxDepth Levels to expand.
+ * @return Depth of the last level reached.
+ */
+uint32_t BfsEngine::run(const CsrGraph& g, uint32_t src, uint32_t maxDepth) {
+    return run(g, std::vector<uint32_t>{src}, maxDepth);
+}
+
+/**
+ * @brief Runs a level-synchronous BFS from several sources, choosing the direction per level.
+ * @param g Graph snapshot.
+ * @param sources Source dense indices.
+ * @param maxDepth Levels to expand.
+ * @return Depth of the last level reached.
+ */
+uint32_t BfsEngine::run(const CsrGraph& g, const std::vector<uint32_t>& sources, uint32_t maxDepth) {
+    prepare(g);
+    uint64_t frontierEdges = 0;
+    for (uint32_t s : sources) {
+        uint64_t bit = 1ULL << (s & 63);
+        if (seen[s >> 6].load(std::memory_order_relaxed) & bit) continue;
+        seen[s >> 6].fetch_or(bit, std::memory_order_relaxed);
+        dist[s] = 0;
+        par[s] = s;
+        visitOrder.push_back(s);
+        frontierEdges += g.degree(s);
+    }
+    levelStart.push_back(visitOrder.size());
+    if (visitOrder.empty()) return 0;
+
+    uint64_t unexplored = g.rowOffsets()[n] - frontierEdges;
+    unsigned workers = workerCount();
+    std::size_t prevFrontier = 0;
+    bool bottom = false;
+    for (uint32_t depth = 1; depth <= maxDepth; ++depth) {
+        std::size_t fb = levelStart[depth - 1], fe = levelStart[depth];
+        std::size_t nf = fe - fb;
+
+        // Heurística de Beamer: bottom-up mientras la frontera es grande
+        if (directionOptimizing) {
+            if (!bottom && frontierEdges > unexplored / ALPHA) bottom = true;
+            else if (bottom && nf < n / BETA && nf < prevFrontier) bottom = false;
+        }
+        prevFrontier = nf;
+
+        uint64_t found;
+        unsigned threads;
+        if (bottom) {
+            std::fill(frontBits.begin(), frontBits.end(), 0);
+            for (std::size_t i = fb; i < fe; ++i) frontBits[visitOrder[i] >> 6] |= 1ULL << (visitOrder[i] & 63);
+            threads = n < PARALLEL_WORK ? 1 : workers;
+            local.resize(threads);
+            for (std::vector<uint32_t>& l : local) l.clear();
+            found = bottomUp(g, static_cast<int>(depth), threads);
+            ++bottomUpSteps;
+        } else {
+            threads = frontierEdges < PARALLEL_WORK ? 1 : workers;
+            local.resize(threads);
+            for (std::vector<uint32_t>& l : local) l.clear();
+            found = topDown(g, fb, fe, static_cast<int>(depth), threads);
+        }
+
+        for (unsigned t = 0; t < threads; ++t)
+            visitOrder.insert(visitOrder.end(), local[t].begin(), local[t].end());
+        if (visitOrder.size() == fe) break;         // nivel vacío: fin del recorrido
+        levelStart.push_back(visitOrder.size());
+        unexplored -= found;
+        frontierEdges = found;
+    }
+    return levels() - 1;
+}
@@ -0,0 +1,220 @@
+/**
+ * @file binary_snapshot.cpp
+ * @brief Implements writing binary graph snapshots and wrapping them from a memory mapping.
+ */
+#include "../include/binary_snapshot.h"
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+namespace {
+
+const char MAGIC[8] = {'R', 'E', 'D', 'S', 'N', 'A', 'P', '\0'};
+const uint32_t ORDER_MARK = 0x01020304;
+
+/// Redondea hacia arriba a múltiplo de 8.
+uint64_t align8(uint64_t x) { return (x + 7) & ~uint64_t(7); }
+
+/// Escribe ceros hasta la posición indicada.
+void padTo(std::ofstream& out, uint64_t& pos, uint64_t target) {
+    static const char zeros[8] = {};
+    out.write(zeros, static_cast<std::streamsize>(target - pos));
+    pos = target;
+}
+
+/// Escribe un bloque binario y avanza la posición.
+void writeBlock(std::ofstream& out, uint64_t& pos, const void* data, uint64_t bytes) {
+    if (bytes) out.write(static_cast<const char*>(data), static_cast<std::streamsize>(bytes));
+    pos += bytes;
+}
+
+/// Une etiquetas con ';' (inverso de User::splitTags).
+std::string joinTags(const std::vector<std::string>& tags) {
+    std::string s;
+    for (std::size_t i = 0; i < tags.size(); ++i) {
+        if (i) s += ';';
+        s += tags[i];
+    }
+    return s;
+}
+
+} // namespace
+
+/**
+ * @brief Maps a snapshot and checks its header, block bounds, index ranges and CSR shape.
+ * @param path Path to the snapshot.
+ * @throws std::runtime_error if the file is missing, truncated or not a snapshot.
+ */
+MappedSnapshot::MappedSnapshot(const std::string& path)
+    : file(std::make_shared<MappedFile>(path)) {
+    const char* base = file->data();
+    uint64_t size = file->size();
+    if (size < sizeof(SnapshotHeader))
+        throw std::runtime_error("Snapshot truncado: " + path);
+    hdr = reinterpret_cast<const SnapshotHeader*>(base);
+    if (std::memcmp(hdr->magic, MAGIC, sizeof(MAGIC)) != 0)
+        throw std::runtime_error("No es un snapshot binario: " + path);
+    if (hdr->version != SNAPSHOT_VERSION)
+        throw std::runtime_error("Versión de snapshot no soportada: " + std::to_string(hdr->version));
+    if (hdr->byteOrder != ORDER_MARK)
+        throw std::runtime_error("Snapshot con orden de bytes distinto: " + path);
+
+    uint64_t n = hdr->numVertices;
+    uint64_t u = hdr->numUsers;
+    // Los conteos vienen del archivo: se comparan con el espacio restante
+    // dividiendo, nunca multiplicando (un conteo forjado desbordaría el producto)
+    auto fits = [&](uint64_t pos, uint64_t count, uint64_t elemSize) {
+        return pos % 8 == 0 && pos <= size && count <= (size - pos) / elemSize;
+    };
+    if (n >= UINT32_MAX ||
+        !fits(hdr->offsetsPos, n + 1, 4) ||
+        !fits(hdr->neighborsPos, hdr->numAdj, 4) ||
+        !fits(hdr->idsPos, n, 8) ||
+        !fits(hdr->usersPos, u, 4 + 4 + 6 * sizeof(StrRef)) ||
+        !fits(hdr->heapPos, hdr->heapSize, 1))
+        throw std::runtime_error("Snapshot corrupto (bloques fuera de rango): " + path);
+
+    offsets = reinterpret_cast<const uint32_t*>(base + hdr->offsetsPos);
+    neighbors = reinterpret_cast<const uint32_t*>(base + hdr->neighborsPos);
+    extIds = reinterpret_cast<const uint64_t*>(base + hdr->idsPos);
+    userVertex = reinterpret_cast<const uint32_t*>(base + hdr->usersPos);
+    userAge = reinterpret_cast<const int32_t*>(userVertex + u);
+    const StrRef* col = reinterpret_cast<const StrRef*>(userAge + u);
+    for (int c = 0; c < 6; ++c) columns[c] = col + c * u;
+    heap = base + hdr->heapPos;
+    if (offsets[0] != 0 || offsets[n] != hdr->numAdj)
+        throw std::runtime_error("Snapshot corrupto (CSR inconsistente): " + path);
+
+    // Una pasada O(n + m): offsets crecientes, filas estrictamente crecientes
+    // dentro de rango y sin lazos, y adyacencia simétrica. Las filas se recorren
+    // en orden de v; cada entrada (v, w) con w > v debe casar con la siguiente
+    // entrada menor que w de la fila w, que se consume con un cursor por fila.
+    for (uint64_t v = 0; v < n; ++v)
+        if (offsets[v] > offsets[v + 1])
+            throw std::runtime_error("Snapshot corrupto (offsets no crecientes): " + path);
+    std::vector<uint32_t> cursor(offsets, offsets + n);
+    for (uint64_t v = 0; v < n; ++v) {
+        for (uint32_t i = offsets[v]; i < offsets[v + 1]; ++i) {
+            uint32_t w = neighbors[i];
+            if (w >= n)
+                throw std::runtime_error("Snapshot corrupto (vecino fuera de rango): " + path);
+            if (w == v || (i > offsets[v] && neighbors[i - 1] >= w))
+                throw std::runtime_error("Snapshot corrupto (fila no ordenada o con lazos): " + path);
+            if (w < v) continue;
+            if (cursor[w] == offsets[w + 1] || neighbors[cursor[w]] != v)
+                throw std::runtime_error("Snapshot corrupto (adyacencia no simétrica): " + path);
+            ++cursor[w];
+        }
+    }
+    // Toda entrada menor que su fila debe haber sido casada
+    for (uint64_t w = 0; w < n; ++w)
+        if (cursor[w] != offsets[w + 1] && neighbors[cursor[w]] < w)
+            throw std::runtime_error("Snapshot corrupto (adyacencia no simétrica): " + path);
+    for (uint64_t i = 0; i < u; ++i)
+        if (userVertex[i] >= n)
+            throw std::runtime_error("Snapshot corrupto (perfil sin vértice): " + path);
+}
+
+/**
+ * @brief Returns a string from a user column, checking it lies inside the heap.
+ * @param column Column index (0 = name ... 5 = profilePic).
+ * @param i Profile row.
+ * @return View into the mapped heap.
+ */
+std::string_view MappedSnapshot::str(int column, std::size_t i) const {
+    StrRef r = columns[column][i];
+    if (static_cast<uint64_t>(r.offset) + r.length > hdr->heapSize)
+        throw std::runtime_error("Snapshot corrupto (cadena fuera del heap)");
+    return std::string_view(heap + r.offset, r.length);
+}
+
+/**
+ * @brief Returns a CSR view over the mapped arrays.
+ * @return Shared snapshot holding a reference to the mapping.
+ */
+std::shared_ptr<const CsrGraph> MappedSnapshot::graph() const {
+    return std::make_shared<const CsrGraph>(offsets, neighbors, numVertices(), file);
+}
+
+/**
+ * @brief Materializes a stored profile.
+ * @param i Profile row.
+ * @return User copied out of the mapping.
+ */
+User MappedSnapshot::user(std::size_t i) const {
+    User usr(extIds[userVertex[i]], std::string(str(0, i)), userAge[i], std::string(str(1, i)),
+             User::splitTags(std::string(str(2, i))), std::string(str(3, i)),
+             std::string(str(4, i)), std::string(str(5, i)));
+    return usr;
+}
+
+/**
+ * @brief Writes header, CSR block, ID block, user columns and string heap.
+ * @param path Destination path.
+ * @param csr Adjacency over dense indices.
+ * @param ids Dense index ↔ external ID map.
+ * @param users Profiles indexed by dense index.
+ * @throws std::runtime_error if the file cannot be written.
+ */
+void MappedSnapshot::write(const std::string& path, const CsrGraph& csr, const IdMap& ids,
+                           const std::vector<User*>& users) {
+    uint64_t n = csr.numVertices();
+
+    // Columnas de usuario y heap de cadenas
+    std::vector<uint32_t> vertex;
+    std::vector<int32_t> age;
+    std::vector<StrRef> cols[6];
+    std::string heapBytes;
+    auto intern = [&](int c, const std::string& s) {
+        if (heapBytes.size() + s.size() > UINT32_MAX)
+            throw std::runtime_error("Snapshot: heap de cadenas mayor a 4 GiB");
+        cols[c].push_back({static_cast<uint32_t>(heapBytes.size()), static_cast<uint32_t>(s.size())});
+        heapBytes += s;
+    };
+    for (uint32_t v = 0; v < users.size(); ++v) {
+        const User* u = users[v];
+        if (!u) continue;
+        vertex.push_back(v);
+        age.push_back(u->age);
+        intern(0, u->name);
+        intern(1, u->city);
+        intern(2, joinTags(u->tags));
+        intern(3, u->email);
+        intern(4, u->password);
+        intern(5, u->profilePic);
+    }
+    std::vector<uint64_t> ext(n);
+    for (uint32_t v = 0; v < n; ++v) ext[v] = ids.external(v);
+
+    SnapshotHeader h{};
+    std::memcpy(h.magic, MAGIC, sizeof(MAGIC));
+    h.version = SNAPSHOT_VERSION;
+    h.byteOrder = ORDER_MARK;
+    h.numVertices = n;
+    h.numAdj = csr.rowOffsets()[n];
+    h.numUsers = vertex.size();
+    h.offsetsPos = align8(sizeof(SnapshotHeader));
+    h.neighborsPos = align8(h.offsetsPos + 4 * (n + 1));
+    h.idsPos = align8(h.neighborsPos + 4 * h.numAdj);
+    h.usersPos = align8(h.idsPos + 8 * n);
+    h.heapPos = align8(h.usersPos + h.numUsers * (4 + 4 + 6 * sizeof(StrRef)));
+    h.heapSize = heapBytes.size();
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) throw std::runtime_error("No se pudo abrir: " + path);
+    uint64_t pos = 0;
+    writeBlock(out, pos, &h, sizeof(h));
+    padTo(out, pos, h.offsetsPos);
+    writeBlock(out, pos, csr.rowOffsets(), 4 * (n + 1));
+    padTo(out, pos, h.neighborsPos);
+    writeBlock(out, pos, csr.neighborArray(), 4 * h.numAdj);
+    padTo(out, pos, h.idsPos);
+    writeBlock(out, pos, ext.data(), 8 * n);
+    padTo(out, pos, h.usersPos);
+    writeBlock(out, pos, vertex.data(), 4 * h.numUsers);
+    writeBlock(out, pos, age.data(), 4 * h.numUsers);
+    for (auto& c : cols) writeBlock(out, pos, c.data(), sizeof(StrRef) * h.numUsers);
+    padTo(out, pos, h.heapPos);
+    writeBlock(out, pos, heapBytes.data(), heapBytes.size());
+    if (!out) throw std::runtime_error("Error al escribir: " + path);
+}
@@ -0,0 +1,108 @@
+/**
+ * @file csr_graph.cpp
+ * @brief Implements CsrGraph construction and the read-only graph analytics that run on it.
+ */
+#include "../include/csr_graph.h"
+#include "../include/path_finder.h"
+#include "../include/bfs_engine.h"
+#include "../include/multi_bfs.h"
+#include <algorithm>
+
+/**
+ * @brief Builds a snapshot from the mutable adjacency; rows are already sorted.
+ * @param adj Sorted neighbor list per internal index.
+ * @param n Number of internal indices assigned so far.
+ */
+CsrGraph::CsrGraph(const std::vector<NeighborList>& adj, uint32_t n) : vertexCount(n) {
+    // Desplazamientos a partir de los grados
+    ownOffsets.assign(n + 1, 0);
+    for (uint32_t i = 0; i < n; ++i)
+        ownOffsets[i + 1] = ownOffsets[i] + static_cast<uint32_t>(i < adj.size() ? adj[i].size() : 0);
+
+    // Filas copiadas tal cual (NeighborList las mantiene ordenadas)
+    ownAdj.resize(ownOffsets[n]);
+    for (uint32_t i = 0; i < n && i < adj.size(); ++i)
+        std::copy(adj[i].begin(), adj[i].end(), ownAdj.begin() + ownOffsets[i]);
+    offsets = ownOffsets.data();
+    adjList = ownAdj.data();
+}
+
+/**
+ * @brief Checks adjacency with a binary search over the sorted neighbor row.
+ * @param u First dense index.
+ * @param v Second dense index.
+ * @return true if u and v are neighbors.
+ */
+bool CsrGraph::hasEdge(uint32_t u, uint32_t v) const {
+    NeighborSpan nu = neighbors(u);
+    return std::binary_search(nu.begin(), nu.end(), v);
+}
+
+/**
+ * @brief Computes the hop distance between two vertices (one-off bidirectional BFS).
+ * @param src Source dense index.
+ * @param dst Destination dense index.
+ * @return Number of hops, or -1 if unreachable.
+ */
+int CsrGraph::shortestPath(uint32_t src, uint32_t dst) const {
+    PathFinder finder;
+    return finder.distance(*this, src, dst);
+}
+
+/**
+ * @brief Counts connected components with one BfsEngine run per component.
+ * @return Number of connected components.
+ */
+int CsrGraph::componentCount() const {
+    uint32_t n = numVertices();
+    std::vector<char> done(n, 0);
+    BfsEngine bfs;
+    int comps = 0;
+    for (uint32_t start = 0; start < n; ++start) {
+        if (done[start] || degree(start) == 0) continue;   // sin amistades: no es vértice
+        ++comps;
+        bfs.run(*this, start);
+        for (uint32_t v : bfs.order()) done[v] = 1;
+    }
+    return comps;
+}
+
+/**
+ * @brief Approximates the diameter with a multi-source BFS from spread-out vertices.
+ *
+ * Sources are taken at an even stride over the non-isolated vertices instead
+ * of the first ones, and are swept LANES at a time.
+ * @param samples Number of BFS sources.
+ * @return Largest eccentricity among the sources.
+ */
+int CsrGraph::approximateDiameter(int samples) const {
+    std::vector<uint32_t> active;
+    for (uint32_t v = 0; v < vertexCount; ++v)
+        if (degree(v) > 0) active.push_back(v);
+    if (active.empty() || samples <= 0) return 0;
+    std::size_t pick = std::min(static_cast<std::size_t>(samples), active.size());
+    std::vector<uint32_t> sources;
+    sources.reserve(pick);
+    for (std::size_t i = 0; i < pick; ++i) sources.push_back(active[i * active.size() / pick]);
+
+    MultiSourceBfs bfs(*this);
+    std::vector<uint32_t> ecc = bfs.eccentricities(sources);
+    return static_cast<int>(*std::max_element(ecc.begin(), ecc.end()));
+}
+
+/**
+ * @brief Counts the triangles once per snapshot and returns the stored result.
+ * @return Triangle statistics of this snapshot.
+ */
+const TriangleStats& CsrGraph::triangles() const {
+    std::call_once(trianglesOnce, [this] { triangleStats = countTriangles(*this); });
+    return triangleStats;
+}
+
+/**
+ * @brief Computes the average local clustering coefficient from the snapshot's triangle counts.
+ * @return Mean clustering coefficient across vertices of degree ≥ 2.
+ */
+double CsrGraph::averageClusteringCoefficient() const {
+    return triangles().averageClustering;
+}
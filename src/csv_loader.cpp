@@ -0,0 +1,171 @@
+/**
+ * @file csv_loader.cpp
+ * @brief Implements the chunked, multi-threaded CSV parsers over memory-mapped files.
+ */
+#include "../include/csv_loader.h"
+#include "../include/mapped_file.h"
+#include "../include/parallel.h"
+#include <charconv>
+#include <cstring>
+#include <stdexcept>
+#include <string_view>
+
+namespace {
+
+/**
+ * @brief Splits [begin, end) into up to parts ranges that start at line beginnings.
+ * @param begin First byte.
+ * @param end One past the last byte.
+ * @param parts Desired number of ranges.
+ * @return Range boundaries; range i is [cuts[i], cuts[i+1]).
+ */
+std::vector<const char*> splitAtLines(const char* begin, const char* end, unsigned parts) {
+    std::vector<const char*> cuts{begin};
+    std::size_t size = static_cast<std::size_t>(end - begin);
+    for (unsigned i = 1; i < parts; ++i) {
+        const char* p = begin + size * i / parts;
+        if (p <= cuts.back()) continue;
+        const char* nl = static_cast<const char*>(std::memchr(p, '\n', end - p));
+        p = nl ? nl + 1 : end;
+        if (p > cuts.back() && p < end) cuts.push_back(p);
+    }
+    cuts.push_back(end);
+    return cuts;
+}
+
+/**
+ * @brief Calls fn(lineBegin, lineEnd) for every line in [p, end), without the trailing '\r'.
+ */
+template<class Fn>
+void forEachLine(const char* p, const char* end, Fn fn) {
+    while (p < end) {
+        const char* nl = static_cast<const char*>(std::memchr(p, '\n', end - p));
+        const char* e = nl ? nl : end;
+        const char* le = (e > p && e[-1] == '\r') ? e - 1 : e;
+        fn(p, le);
+        p = nl ? nl + 1 : end;
+    }
+}
+
+/// Avanza sobre espacios y tabuladores.
+const char* skipSpaces(const char* p, const char* end) {
+    while (p < end && (*p == ' ' || *p == '\t')) ++p;
+    return p;
+}
+
+/**
+ * @brief Parses a whole field as an integer, allowing surrounding spaces.
+ * @return true if the field holds exactly one integer.
+ */
+template<class T>
+bool parseField(const char* b, const char* e, T& out) {
+    b = skipSpaces(b, e);
+    auto r = std::from_chars(b, e, out);
+    return r.ec == std::errc() && skipSpaces(r.ptr, e) == e;
+}
+
+/**
+ * @brief Returns the end of the comma-separated field starting at p.
+ */
+const char* fieldEnd(const char* p, const char* end) {
+    const char* c = static_cast<const char*>(std::memchr(p, ',', end - p));
+    return c ? c : end;
+}
+
+/// true si la línea solo contiene espacios.
+bool blank(const char* b, const char* e) { return skipSpaces(b, e) == e; }
+
+/**
+ * @brief Runs parse(chunkBegin, chunkEnd, out, malformed) on each chunk in parallel and
+ *        concatenates the outputs in file order.
+ */
+template<class T, class Parse>
+std::vector<T> parseChunks(const char* begin, const char* end, CsvLoadStats& stats, Parse parse) {
+    std::vector<const char*> cuts = splitAtLines(begin, end, workerCount());
+    std::size_t parts = cuts.size() - 1;
+    std::vector<std::vector<T>> partial(parts);
+    std::vector<std::size_t> bad(parts, 0);
+    parallelFor(parts, [&](std::size_t b, std::size_t e, unsigned) {
+        for (std::size_t i = b; i < e; ++i) parse(cuts[i], cuts[i + 1], partial[i], bad[i]);
+    }, static_cast<unsigned>(parts));
+
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < parts; ++i) {
+        total += partial[i].size();
+        stats.malformed += bad[i];
+    }
+    std::vector<T> out;
+    out.reserve(total);
+    for (auto& part : partial)
+        for (auto& item : part) out.push_back(std::move(item));
+    stats.rows += out.size();
+    return out;
+}
+
+} // namespace
+
+/**
+ * @brief Parses an edge file in parallel chunks.
+ * @param path Path to the CSV file.
+ * @param stats Receives row and malformed-line counts.
+ * @return Edge pairs in file order.
+ */
+std::vector<std::pair<uint64_t, uint64_t>> parseEdgesCsv(const std::string& path, CsvLoadStats& stats) {
+    MappedFile file(path);
+    const char* begin = file.data();
+    const char* end = begin + file.size();
+    return parseChunks<std::pair<uint64_t, uint64_t>>(begin, end, stats,
+        [](const char* b, const char* e, std::vector<std::pair<uint64_t, uint64_t>>& out, std::size_t& bad) {
+            out.reserve(static_cast<std::size_t>(e - b) / 8);
+            forEachLine(b, e, [&](const char* lb, const char* le) {
+                if (blank(lb, le)) return;
+                const char* c1 = fieldEnd(lb, le);
+                if (c1 == le) { ++bad; return; }
+                const char* c2 = fieldEnd(c1 + 1, le);
+                uint64_t u, v;
+                if (parseField(lb, c1, u) && parseField(c1 + 1, c2, v)) out.emplace_back(u, v);
+                else ++bad;
+            });
+        });
+}
+
+/**
+ * @brief Parses a user file (after its header line) in parallel chunks.
+ * @param path Path to the CSV file.
+ * @param stats Receives row and malformed-line counts.
+ * @return Parsed profiles in file order.
+ */
+std::vector<User> parseUsersCsv(const std::string& path, CsvLoadStats& stats) {
+    MappedFile file(path);
+    const char* begin = file.data();
+    const char* end = begin + file.size();
+    // descarta cabecera
+    const char* nl = begin ? static_cast<const char*>(std::memchr(begin, '\n', end - begin)) : nullptr;
+    begin = nl ? nl + 1 : end;
+
+    return parseChunks<User>(begin, end, stats,
+        [](const char* b, const char* e, std::vector<User>& out, std::size_t& bad) {
+            forEachLine(b, e, [&](const char* lb, const char* le) {
+                if (blank(lb, le)) return;
+                // hasta 7 columnas: id,name,age,city,tags,email,password
+                std::string_view f[7];
+                const char* p = lb;
+                for (int i = 0; i < 7; ++i) {
+                    const char* fe = fieldEnd(p, le);
+                    f[i] = std::string_view(p, fe - p);
+                    if (fe == le) break;
+                    p = fe + 1;
+                }
+                uint64_t id;
+                int age;
+                if (!parseField(f[0].data(), f[0].data() + f[0].size(), id) ||
+                    !parseField(f[2].data(), f[2].data() + f[2].size(), age)) {
+                    ++bad;
+                    return;
+                }
+                out.emplace_back(id, std::string(f[1]), age, std::string(f[3]),
+                                 User::splitTags(std::string(f[4])),
+                                 std::string(f[5]), std::string(f[6]));
+            });
+        });
+}
@@ -0,0 +1,92 @@
+/**
+ * @file diameter.cpp
+ * @brief Implements exact diameter computation with iFUB over the multi-source BFS.
+ */
+#include "../include/diameter.h"
+#include "../include/csr_graph.h"
+#include "../include/bfs_engine.h"
+#include "../include/multi_bfs.h"
+#include <algorithm>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief iFUB on the component of r.
+ * @param best Diameter already known from other components (prunes early).
+ * @return Diameter of r's component, or a value ≤ best if it cannot beat it.
+ */
+uint32_t componentDiameter(const CsrGraph& g, BfsEngine& bfs, MultiSourceBfs& multi, uint32_t r,
+                           uint32_t best, DiameterStats& st) {
+    // Doble barrido: r → a (periférico) → b; u = punto medio del camino a–b
+    uint32_t er = bfs.run(g, r);
+    uint32_t a = bfs.order().back();
+    uint32_t lb = bfs.run(g, a);
+    uint32_t b = bfs.order().back();
+    uint32_t u = b;
+    for (uint32_t steps = lb / 2; steps > 0; --steps) u = bfs.parent(u);
+    uint32_t runs = 3, e = bfs.run(g, u);
+    if (er < e) {                                 // el hub es más central: partir de él
+        u = r;
+        e = bfs.run(g, u);
+        ++runs;
+    }
+    st.bfsRuns += runs;
+    st.sweeps += runs;
+    lb = std::max(lb, e);
+    if (2 * e <= best) return lb;                 // no puede superar lo ya conocido
+
+    // Niveles F_i desde u: quedan en bfs hasta el final
+    for (uint32_t i = e; i > 0; --i) {
+        // Ningún par dentro de los niveles ≤ i dista más de 2i
+        if (std::max(lb, best) >= 2 * i) return lb;
+        std::pair<const uint32_t*, const uint32_t*> level = bfs.level(i);
+        std::size_t size = static_cast<std::size_t>(level.second - level.first);
+        for (std::size_t base = 0; base < size; base += MultiSourceBfs::LANES) {
+            std::size_t count = std::min(MultiSourceBfs::LANES, size - base);
+            std::vector<uint32_t> batch(level.first + base, level.first + base + count);
+            std::vector<uint32_t> ecc = multi.eccentricities(batch);
+            st.bfsRuns += count;
+            ++st.sweeps;
+            lb = std::max(lb, *std::max_element(ecc.begin(), ecc.end()));
+            if (lb >= 2 * i) return lb;           // el resto del nivel tampoco supera 2i
+        }
+    }
+    return lb;
+}
+
+} // namespace
+
+/**
+ * @brief Computes the exact diameter, component by component (largest first).
+ * @param g Snapshot to analyze.
+ * @return Diameter and work counters.
+ */
+DiameterStats exactDiameter(const CsrGraph& g) {
+    uint32_t n = g.numVertices();
+    DiameterStats st;
+
+    // Componentes: tamaño y vértice de mayor grado de cada una
+    struct Comp { uint32_t size, root; };
+    std::vector<Comp> comps;
+    std::vector<char> seen(n, 0);
+    BfsEngine bfs;
+    for (uint32_t s = 0; s < n; ++s) {
+        if (seen[s] || g.degree(s) == 0) continue;
+        bfs.run(g, s);
+        uint32_t root = s;
+        for (uint32_t v : bfs.order()) {
+            seen[v] = 1;
+            if (g.degree(v) > g.degree(root)) root = v;
+        }
+        comps.push_back({static_cast<uint32_t>(bfs.order().size()), root});
+    }
+    std::sort(comps.begin(), comps.end(), [](const Comp& x, const Comp& y) { return x.size > y.size; });
+
+    MultiSourceBfs multi(g);
+    for (const Comp& c : comps) {
+        if (c.size - 1 <= st.diameter) break;     // las restantes son aún más pequeñas
+        st.diameter = std::max(st.diameter, componentDiameter(g, bfs, multi, c.root, st.diameter, st));
+    }
+    return st;
+}
@@ -0,0 +1,107 @@
+/**
+ * @file feed.cpp
+ * @brief Implements the k-way merge behind paginated feeds.
+ */
+#include "../include/feed.h"
+#include <algorithm>
+#include <utility>
+
+/**
+ * @brief Adds the authors' post lists as runs, skipping repeated authors and empty lists.
+ * @param store Post storage.
+ * @param list Author IDs.
+ */
+void FeedMerger::addAuthors(const PostStore& store, const std::vector<uint64_t>& list) {
+    lists.clear();
+    for (uint64_t a : list) {
+        const std::vector<uint64_t>& l = store.byAuthor(a);
+        if (!l.empty()) lists.push_back(&l);
+    }
+    std::sort(lists.begin(), lists.end());
+    lists.erase(std::unique(lists.begin(), lists.end()), lists.end());    // autores repetidos
+    for (const std::vector<uint64_t>* l : lists) runs.push_back({l->data(), l->size()});
+}
+
+/**
+ * @brief Merges the runs from the cursor downwards into out.
+ * @param limit Maximum number of IDs to append.
+ * @param cursor 0 for the newest post, otherwise only IDs below it.
+ * @param floor Smallest ID that may be emitted (0 = none).
+ * @return true if IDs remain below the last one emitted.
+ */
+bool FeedMerger::merge(std::size_t limit, uint64_t cursor, uint64_t floor) {
+    auto older = [](const Head& a, const Head& b) { return a.id < b.id; };   // max-heap por ID
+
+    heap.clear();
+    for (const PostRun& r : runs) {
+        // Posts con ID < cursor: todo lo anterior a lower_bound
+        std::size_t end = cursor ? std::lower_bound(r.ids, r.ids + r.size, cursor) - r.ids : r.size;
+        if (end > 0) heap.push_back({r.ids[end - 1], r.ids, end - 1});
+    }
+    std::make_heap(heap.begin(), heap.end(), older);
+
+    // Avanza la corrida de la cabeza más nueva
+    auto advance = [&]() {
+        std::pop_heap(heap.begin(), heap.end(), older);
+        Head& h = heap.back();
+        if (h.pos > 0) {
+            --h.pos;
+            h.id = h.run[h.pos];
+            std::push_heap(heap.begin(), heap.end(), older);
+        } else {
+            heap.pop_back();
+        }
+    };
+
+    std::size_t taken = 0;
+    uint64_t last = 0;
+    while (!heap.empty() && taken < limit && heap.front().id >= floor) {
+        uint64_t id = heap.front().id;
+        advance();
+        if (taken && id == last) continue;              // repetido en otra corrida
+        out.push_back(id);
+        last = id;
+        ++taken;
+    }
+    // Las copias del último post que sigan en otras corridas no cuentan como "más"
+    while (taken && !heap.empty() && heap.front().id == last) advance();
+    return !heap.empty();
+}
+
+/**
+ * @brief Merges sorted post-ID runs into a freshly allocated page.
+ * @param runs Ascending runs.
+ * @param limit Maximum number of posts in the page.
+ * @param cursor 0 for the first page, otherwise the previous page's next.
+ * @param floor Smallest ID that may be returned (0 = none).
+ * @return Page of post IDs, newest first, with its continuation cursor.
+ */
+FeedPage mergeRuns(const std::vector<PostRun>& runs, std::size_t limit,
+                   uint64_t cursor, uint64_t floor) {
+    FeedMerger m;
+    m.runs = runs;
+    FeedPage page;
+    page.more = m.merge(limit, cursor, floor);
+    page.posts.swap(m.out);
+    page.next = page.posts.empty() ? cursor : page.posts.back();
+    return page;
+}
+
+/**
+ * @brief Merges the authors' post lists from the cursor downwards.
+ * @param store Post storage.
+ * @param authors Author IDs (duplicates are ignored).
+ * @param limit Maximum number of posts in the page.
+ * @param cursor 0 for the first page, otherwise the previous page's next.
+ * @return Page of post IDs, newest first, with its continuation cursor.
+ */
+FeedPage mergeFeed(const PostStore& store, const std::vector<uint64_t>& authors,
+                   std::size_t limit, uint64_t cursor) {
+    FeedMerger m;
+    m.addAuthors(store, authors);
+    FeedPage page;
+    page.more = m.merge(limit, cursor);
+    page.posts.swap(m.out);
+    page.next = page.posts.empty() ? cursor : page.posts.back();
+    return page;
+}
@@ -4,10 +4,29 @@
  */
 #include <nlohmann/json.hpp>
 #include "../include/graph.h"
+#include "../include/parallel.h"
+#include "../include/binary_snapshot.h"
+#include "../include/json_stream.h"
+#include "../include/intersect.h"
+#include "../include/multi_bfs.h"
+#include "../include/bfs_engine.h"
+#include "../include/path_finder.h"
 #include <fstream>
 #include <sstream>
 #include <random>     // for sampling if needed
 #include <ctime>
+#include <chrono>
+#include <algorithm>
+
+namespace {
+
+/// Buffers de BFS bidireccional por hilo: las lecturas const no comparten estado.
+PathFinder& localPathFinder() {
+    thread_local PathFinder finder;
+    return finder;
+}
+
+} // namespace
 
 /**
  * @brief Computes the shortest path length (number of hops) between two users.
@@ -15,73 +34,151 @@
  * @param dst Destination user ID.
  * @return Number of edges in the shortest path, or -1 if no path exists.
  */
-int Graph::shortestPath(int src, int dst) const {
+int Graph::shortestPath(uint64_t src, uint64_t dst) const {
     if (src == dst) return 0;
 
-    LinkedList* listSrc = adj.get(src);
-    LinkedList* listDst = adj.get(dst);
-    if (!listSrc || !listDst) return -1;        // uno de los dos no existe
-
-    std::unordered_map<int, int> dist;          // nodo → distancia
-    std::queue<int> q;
-
-    dist[src] = 0;
-    q.push(src);
-
-    while (!q.empty()) {
-        int u = q.front();
-        q.pop();
+    uint32_t s = ids.find(src);
+    uint32_t t = ids.find(dst);
+    if (s == IdMap::NONE || t == IdMap::NONE) return -1;   // uno de los dos no existe
+    return localPathFinder().distance(*snapshot(), s, t);
+}
 
-        LinkedList* neigh = adj.get(u);
-        if (!neigh) continue;
+/**
+ * @brief Reconstructs a shortest path between two users as a list of user IDs.
+ * @param src Source user ID.
+ * @param dst Destination user ID.
+ * @return User IDs along the path, or empty if no path exists.
+ */
+std::vector<uint64_t> Graph::shortestPathRoute(uint64_t src, uint64_t dst) const {
+    if (src == dst) return {src};
+    uint32_t s = ids.find(src);
+    uint32_t t = ids.find(dst);
+    if (s == IdMap::NONE || t == IdMap::NONE) return {};
+    std::vector<uint64_t> route;
+    for (uint32_t v : localPathFinder().path(*snapshot(), s, t)) route.push_back(ids.external(v));
+    return route;
+}
 
-        for (Node* p = neigh->begin(); p; p = p->next) {
-            int v = p->key;
-            if (!dist.count(v)) {
-                dist[v] = dist[u] + 1;
-                if (v == dst) return dist[v];   // encontrado
-                q.push(v);
-            }
-        }
-    }
-    return -1;  // sin camino
+/**
+ * @brief Returns the cached CSR snapshot, rebuilding it if edges or users changed.
+ * @return Shared pointer to the current snapshot.
+ */
+std::shared_ptr<const CsrGraph> Graph::snapshot() const {
+    // Los perfiles nuevos también reciben índice: el snapshot debe cubrirlos
+    if (!csr || csr->numVertices() != ids.size())
+        csr = std::make_shared<const CsrGraph>(adj, ids.size());
+    return csr;
 }
 
 /**
  * @brief Constructs an empty Graph with default initial capacity.
  */
-Graph::Graph() : adj(101), edges(0) {}
+Graph::Graph() : active(0), edges(0), nextId(1) {}
 
 /**
  * @brief Adds an undirected friendship edge between two users.
  * @param u First user ID.
  * @param v Second user ID.
  */
-void Graph::addEdge(int u, int v) {
+void Graph::addEdge(uint64_t u, uint64_t v) {
     if (u == v) return;                 // evita bucles
-    LinkedList* listU = adj.get(u);
-    if (!listU) {
-        listU = new LinkedList();
-        adj.put(u, listU);
+    uint32_t iu = internVertex(u);
+    uint32_t iv = internVertex(v);
+    if (adj.size() < ids.size()) adj.resize(ids.size());
+    if (!adj[iu].insert(iv)) return;    // ya eran amigos
+    adj[iv].insert(iu);
+    active += (adj[iu].size() == 1) + (adj[iv].size() == 1);
+    ++edges;
+    csr.reset();                        // snapshot obsoleto
+    if (timelines) {
+        timelines->invalidate(iu);
+        timelines->invalidate(iv);
+    }
+    if (!compsStale) {
+        comps.grow(ids.size());
+        comps.unite(iu, iv);
+    }
+}
+
+/**
+ * @brief Adds a batch of undirected friendships with one sort and one fill pass.
+ * @param list Pairs (u, v) of user IDs.
+ */
+void Graph::addEdges(const std::vector<std::pair<uint64_t, uint64_t>>& list) {
+    // Pares dirigidos (origen << 32 | destino) en ambos sentidos, sin bucles
+    std::vector<uint64_t> directed;
+    directed.reserve(list.size() * 2);
+    for (const auto& e : list) {
+        if (e.first == e.second) continue;
+        uint64_t a = ids.intern(e.first);
+        uint64_t b = ids.intern(e.second);
+        directed.push_back((a << 32) | b);
+        directed.push_back((b << 32) | a);
+    }
+    parallelSort(directed);
+    directed.erase(std::unique(directed.begin(), directed.end()), directed.end());
+
+    // Descartar amistades que ya existían (simétrico: caen ambos sentidos)
+    if (edges > 0) {
+        directed.erase(std::remove_if(directed.begin(), directed.end(), [&](uint64_t d) {
+            uint32_t src = static_cast<uint32_t>(d >> 32);
+            return src < adj.size() && adj[src].contains(static_cast<uint32_t>(d & 0xffffffffu));
+        }), directed.end());
+    }
+    if (directed.empty()) return;
+
+    // Orígenes distintos; los que no tenían amistades pasan a ser vértices
+    uint32_t n = ids.size();
+    adj.resize(n);
+    std::vector<uint32_t> sources;
+    for (std::size_t i = 0; i < directed.size(); ++i) {
+        uint32_t src = static_cast<uint32_t>(directed[i] >> 32);
+        if (i == 0 || src != static_cast<uint32_t>(directed[i - 1] >> 32)) {
+            sources.push_back(src);
+            active += adj[src].empty();
+        }
     }
-    LinkedList* listV = adj.get(v);
-    if (!listV) {
-        listV = new LinkedList();
-        adj.put(v, listV);
+
+    // Un solo recorrido; cada hilo fusiona los destinos (ya ordenados) de un rango de orígenes
+    parallelFor(sources.size(), [&](std::size_t b, std::size_t e, unsigned) {
+        auto it = std::lower_bound(directed.begin(), directed.end(),
+                                   static_cast<uint64_t>(sources[b]) << 32);
+        std::vector<uint32_t> batch;
+        while (it != directed.end() && (*it >> 32) <= sources[e - 1]) {
+            uint32_t src = static_cast<uint32_t>(*it >> 32);
+            batch.clear();
+            for (; it != directed.end() && (*it >> 32) == src; ++it)
+                batch.push_back(static_cast<uint32_t>(*it & 0xffffffffu));
+            adj[src].mergeSorted(batch.data(), batch.size());
+        }
+    });
+
+    if (timelines) timelines->invalidateAll();
+
+    // Componentes: lotes grandes se reconstruyen en paralelo en la próxima consulta
+    std::size_t added = directed.size() / 2;
+    if (added > static_cast<std::size_t>(edges)) compsStale = true;
+    if (!compsStale) {
+        comps.grow(n);
+        for (uint64_t d : directed) {
+            uint32_t a = static_cast<uint32_t>(d >> 32), b = static_cast<uint32_t>(d & 0xffffffffu);
+            if (a < b) comps.unite(a, b);
+        }
     }
-    bool existed = listU->contains(v);  // para no contar 2 veces
-    listU->insert(v);
-    listV->insert(u);
-    if (!existed) ++edges;
+
+    edges += static_cast<int>(added);
+    csr.reset();                        // snapshot obsoleto
 }
 
 /**
- * @brief Retrieves the adjacency list of a user.
+ * @brief Retrieves the friends of a user.
  * @param u User ID.
- * @return Pointer to a LinkedList of neighbor IDs, or nullptr if none.
+ * @return Vector of neighbor user IDs, empty if none.
  */
-LinkedList* Graph::neighbors(int u) const {
-    return adj.get(u);
+FriendRange Graph::neighbors(uint64_t u) const {
+    uint32_t iu = ids.find(u);
+    if (iu == IdMap::NONE || iu >= adj.size()) return FriendRange(nullptr, nullptr, &ids);
+    return FriendRange(adj[iu].begin(), adj[iu].end(), &ids);
 }
 
 /**
@@ -90,9 +187,46 @@ LinkedList* Graph::neighbors(int u) const {
  * @param v Second user ID.
  * @return true if the users are friends, false otherwise.
  */
-bool Graph::areFriends(int u, int v) const {
-    LinkedList* n = adj.get(u);
-    return n && n->contains(v);
+bool Graph::areFriends(uint64_t u, uint64_t v) const {
+    uint32_t iu = ids.find(u);
+    uint32_t iv = ids.find(v);
+    if (iu == IdMap::NONE || iv == IdMap::NONE) return false;
+    return iu < adj.size() && adj[iu].contains(iv);
+}
+
+/**
+ * @brief Counts mutual friends by intersecting both CSR rows.
+ * @param a First user ID.
+ * @param b Second user ID.
+ * @return Number of common neighbors.
+ */
+std::size_t Graph::mutualFriendCount(uint64_t a, uint64_t b) const {
+    uint32_t ia = ids.find(a);
+    uint32_t ib = ids.find(b);
+    if (ia == IdMap::NONE || ib == IdMap::NONE) return 0;
+    std::shared_ptr<const CsrGraph> view = snapshot();
+    NeighborSpan na = view->neighbors(ia), nb = view->neighbors(ib);
+    return intersectCount(na.begin(), na.size(), nb.begin(), nb.size());
+}
+
+/**
+ * @brief Lists mutual friends by intersecting both CSR rows.
+ * @param a First user ID.
+ * @param b Second user ID.
+ * @return Common neighbors' user IDs.
+ */
+std::vector<uint64_t> Graph::mutualFriends(uint64_t a, uint64_t b) const {
+    uint32_t ia = ids.find(a);
+    uint32_t ib = ids.find(b);
+    if (ia == IdMap::NONE || ib == IdMap::NONE) return {};
+    std::shared_ptr<const CsrGraph> view = snapshot();
+    NeighborSpan na = view->neighbors(ia), nb = view->neighbors(ib);
+    std::vector<uint32_t> common(std::min(na.size(), nb.size()));
+    common.resize(intersect(na.begin(), na.size(), nb.begin(), nb.size(), common.data()));
+    std::vector<uint64_t> out;
+    out.reserve(common.size());
+    for (uint32_t v : common) out.push_back(ids.external(v));
+    return out;
 }
 
 /**
@@ -100,32 +234,30 @@ bool Graph::areFriends(int u, int v) const {
  * @param u User ID.
  * @return Number of adjacent friends.
  */
-int Graph::degree(int u) const {
-    LinkedList* n = adj.get(u);
-    return n ? static_cast<int>(n->size()) : 0;
+int Graph::degree(uint64_t u) const {
+    uint32_t iu = ids.find(u);
+    if (iu == IdMap::NONE) return 0;
+    return iu < adj.size() ? static_cast<int>(adj[iu].size()) : 0;
 }
 
 /**
  * @brief Loads friendship edges from a CSV file.
  * @param path Path to the CSV file containing lines "u,v" per edge.
+ * @return Load statistics (rows, malformed lines, seconds).
  * @throws runtime_error if file cannot be opened.
  */
-void Graph::loadCSV(const std::string& path) {
-    std::ifstream file(path);
-    if (!file.is_open())
+CsvLoadStats Graph::loadCSV(const std::string& path) {
+    auto t0 = std::chrono::steady_clock::now();
+    CsvLoadStats stats;
+    std::vector<std::pair<uint64_t, uint64_t>> batch;
+    try {
+        batch = parseEdgesCsv(path, stats);
+    } catch (const std::runtime_error&) {
         throw std::runtime_error("No se pudo abrir CSV: " + path);
-
-    std::string line;
-    while (std::getline(file, line)) {
-        if (line.empty()) continue;
-        std::stringstream ss(line);
-        std::string a, b;
-        if (!std::getline(ss, a, ',')) continue;
-        if (!std::getline(ss, b, ',')) continue;
-        int u = std::stoi(a);
-        int v = std::stoi(b);
-        addEdge(u, v);
     }
+    addEdges(batch);
+    stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    return stats;
 }
 
 /**
@@ -133,75 +265,72 @@ void Graph::loadCSV(const std::string& path) {
  * @return Number of connected components.
  */
 int Graph::bfsComponentCount() const {
-    std::vector<int> keys = adj.keySet();
-    std::unordered_map<int, bool> visited;
-    visited.reserve(keys.size() * 2);
-
-    int comps = 0;
-    std::queue<int> q;
-    for (int start : keys) {
-        if (visited[start]) continue;
-        ++comps;
-        visited[start] = true;
-        q.push(start);
-        while (!q.empty()) {
-            int u = q.front(); q.pop();
-            LinkedList* neigh = adj.get(u);
-            if (!neigh) continue;
-            for (Node* p = neigh->begin(); p; p = p->next) {
-                int v = p->key;
-                if (!visited[v]) {
-                    visited[v] = true;
-                    q.push(v);
-                }
-            }
-        }
+    return snapshot()->componentCount();
+}
+
+/**
+ * @brief Returns the union-find forest, rebuilding it in parallel if it is stale.
+ * @return Forest; indices it does not cover yet are singletons.
+ */
+const UnionFind& Graph::components() const {
+    if (compsStale) {
+        comps.rebuild(*snapshot());
+        compsStale = false;
     }
-    return comps;
+    return comps;   // los índices aún no cubiertos son conjuntos unitarios
+}
+
+/**
+ * @brief Counts connected components as (vertices with friends) − (successful unions).
+ * @return Number of connected components.
+ */
+int Graph::componentCount() const {
+    return numVertices() - static_cast<int>(components().merges());
+}
+
+/**
+ * @brief Checks whether two users belong to the same connected component.
+ * @param a First user ID.
+ * @param b Second user ID.
+ * @return true if they are connected.
+ */
+bool Graph::sameComponent(uint64_t a, uint64_t b) const {
+    if (a == b) return true;
+    uint32_t ia = ids.find(a);
+    uint32_t ib = ids.find(b);
+    if (ia == IdMap::NONE || ib == IdMap::NONE) return false;
+    return components().connected(ia, ib);
 }
 
 /**
  * @brief Loads user profiles from a CSV file.
  * @param path Path to the CSV file with header and lines "id,name,age,city,tags".
+ * @return Load statistics (rows, malformed lines, seconds).
  * @throws runtime_error if file cannot be opened.
  */
-void Graph::loadUsersCSV(const std::string& path) {
-    std::ifstream file(path);
-    if (!file.is_open())
+CsvLoadStats Graph::loadUsersCSV(const std::string& path) {
+    auto t0 = std::chrono::steady_clock::now();
+    CsvLoadStats stats;
+    std::vector<User> parsed;
+    try {
+        parsed = parseUsersCsv(path, stats);
+    } catch (const std::runtime_error&) {
         throw std::runtime_error("No se pudo abrir CSV usuarios: " + path);
+    }
 
-    std::string line;
-    // descarta cabecera
-    std::getline(file, line);
-
-    while (std::getline(file, line)) {
-        if (line.empty()) continue;
-        std::stringstream ss(line);
-        std::string sId, name, sAge, city, tagStr;
-        std::getline(ss, sId, ',');
-        std::getline(ss, name, ',');
-        std::getline(ss, sAge, ',');
-        std::getline(ss, city, ',');
-        std::getline(ss, tagStr, ',');
-        std::string email;
-        std::getline(ss, email, ',');
-        std::string password;
-        std::getline(ss, password, ',');
-
-        int id  = std::stoi(sId);
-        int age = std::stoi(sAge);
-        std::vector<std::string> tags = User::splitTags(tagStr);
-
-        users[id] = new User(id, name, age, city, tags, email, password);
-        usernames.insert(name);           // registrar nombre para unicidad
+    for (User& u : parsed) {
+        usernames.insert(u.name);         // registrar nombre para unicidad
+        setProfile(std::move(u));
     }
     // Inicializar nextId tras cargar usuarios
     {
         uint64_t maxId = 0;
-        for (const auto& pair : users)
-            if (pair.first > maxId) maxId = pair.first;
+        for (const User* u : users)
+            if (u && u->id > maxId) maxId = u->id;
         nextId = maxId + 1;
     }
+    stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    return stats;
 }
 
 /**
@@ -209,9 +338,42 @@ void Graph::loadUsersCSV(const std::string& path) {
  * @param id The user ID.
  * @return Pointer to the User or nullptr if not found.
  */
-User* Graph::getUser(int id) const {
-    auto it = users.find(id);
-    return (it == users.end()) ? nullptr : it->second;
+User* Graph::getUser(uint64_t id) const {
+    uint32_t i = ids.find(id);
+    return (i < users.size()) ? users[i] : nullptr;
+}
+
+/**
+ * @brief Returns a user's internal index, assigning one if needed.
+ *
+ * Authors without an index are never pushed to timelines and readers pull
+ * them instead; when one gets an index its followers' rings are marked stale
+ * so the next read rebuilds them with that author as a pushed source.
+ * @param id External user ID.
+ * @return Dense internal index.
+ */
+uint32_t Graph::internVertex(uint64_t id) {
+    uint32_t before = ids.size();
+    uint32_t i = ids.intern(id);
+    if (timelines && i == before) {
+        auto it = followersMap_.find(id);
+        if (it != followersMap_.end())
+            for (uint64_t f : it->second) invalidateTimeline(f);
+    }
+    return i;
+}
+
+/**
+ * @brief Creates a profile in the pool and stores it in the slot of its internal index.
+ * @param u Profile data (moved into the pool); replaces any profile with the same ID.
+ * @return The stored profile.
+ */
+User* Graph::setProfile(User&& u) {
+    uint32_t i = internVertex(u.id);
+    if (i >= users.size()) users.resize(ids.size(), nullptr);
+    profiles.destroy(users[i]);
+    users[i] = profiles.create(std::move(u));
+    return users[i];
 }
 
 /**
@@ -221,12 +383,60 @@ User* Graph::getUser(int id) const {
  */
 bool Graph::addUser(const User& u) {
     if (usernames.count(u.name)) return false;      // nombre ya registrado
-    if (users.count(u.id)) return false;            // id ya existe (raro)
-    users[u.id] = new User(u);
+    if (getUser(u.id)) return false;                // id ya existe (raro)
+    setProfile(User(u));
     usernames.insert(u.name);
     return true;
 }
 
+/**
+ * @brief Removes a user's profile, friendships and follow relations.
+ * @param id The user ID to remove.
+ * @return true if anything was removed, false otherwise.
+ */
+bool Graph::removeUser(uint64_t id) {
+    // Un usuario que solo sigue o es seguido no tiene índice denso
+    uint32_t iu = ids.find(id);
+    bool removed = false;
+
+    // Amistades: quitar u de cada vecino y luego su propia entrada
+    if (iu != IdMap::NONE && iu < adj.size() && !adj[iu].empty()) {
+        for (uint32_t w : adj[iu]) {
+            if (timelines) timelines->invalidate(w);
+            adj[w].erase(iu);
+            if (adj[w].empty()) --active;   // vecino sin amistades
+            --edges;
+        }
+        adj[iu].clear();
+        --active;
+        csr.reset();
+        compsStale = true;              // union-find no admite borrados
+        removed = true;
+    }
+
+    // Perfil
+    if (iu != IdMap::NONE && iu < users.size() && users[iu]) {
+        usernames.erase(users[iu]->name);
+        profiles.destroy(users[iu]);
+        users[iu] = nullptr;
+        removed = true;
+    }
+
+    // Seguidores / seguidos
+    if (timelines && iu != IdMap::NONE) timelines->invalidate(iu);
+    if (!followingOf(id).empty() || !followersOf(id).empty()) removed = true;
+    for (uint64_t f : getFollowing(id)) unfollow(id, f);
+    for (uint64_t f : getFollowers(id)) unfollow(f, id);
+    followingMap_.erase(id);
+    followersMap_.erase(id);
+    uint32_t key = boardKeys.find(id);
+    if (key != IdMap::NONE) {
+        followerBoard.erase(static_cast<int>(key));
+        likeBoard.erase(static_cast<int>(key));
+    }
+    return removed;
+}
+
 /**
  * @brief Checks if a username is already taken.
  * @param name The username to check.
@@ -252,8 +462,8 @@ nlohmann::json Graph::toJson() const {
     nlohmann::json j;
     // Usuarios
     j["users"] = nlohmann::json::array();
-    for (const auto& pair : users) {
-        const User* u = pair.second;
+    for (const User* u : users) {
+        if (!u) continue;
         j["users"].push_back({
             {"id", u->id},
             {"name", u->name},
@@ -264,14 +474,12 @@ nlohmann::json Graph::toJson() const {
             {"password", u->password}
         });
     }
-    // Aristas (solo una vez por par)
+    // Aristas (solo una vez por par), también entre usuarios sin perfil
     j["edges"] = nlohmann::json::array();
-    for (const auto& pair : users) {
-        uint64_t u = pair.first;
-        LinkedList* neigh = adj.get(static_cast<int>(u));
-        if (!neigh) continue;
-        for (Node* p = neigh->begin(); p; p = p->next) {
-            uint64_t v = p->key;
+    for (uint32_t i = 0; i < adj.size(); ++i) {
+        uint64_t u = ids.external(i);
+        for (uint32_t w : adj[i]) {
+            uint64_t v = ids.external(w);
             if (v > u) {
                 j["edges"].push_back({u, v});
             }
@@ -280,6 +488,57 @@ nlohmann::json Graph::toJson() const {
     return j;
 }
 
+/**
+ * @brief Writes the graph as JSON one user / edge at a time.
+ * @param os Destination stream.
+ */
+void Graph::writeJson(std::ostream& os) const {
+    os << "{\n\"users\": [";
+    bool first = true;
+    for (const User* u : users) {
+        if (!u) continue;
+        // Objeto pequeño por usuario: nlohmann se encarga del escapado
+        nlohmann::json uj = {
+            {"id", u->id},
+            {"name", u->name},
+            {"age", u->age},
+            {"city", u->city},
+            {"tags", u->tags},
+            {"email", u->email},
+            {"password", u->password},
+            {"profilePic", u->profilePic}
+        };
+        os << (first ? "\n  " : ",\n  ") << uj.dump();
+        first = false;
+    }
+    os << "\n],\n\"edges\": [";
+    first = true;
+    for (uint32_t i = 0; i < adj.size(); ++i) {
+        uint64_t u = ids.external(i);
+        for (uint32_t w : adj[i]) {
+            uint64_t v = ids.external(w);
+            if (v > u) {
+                os << (first ? "\n  [" : ",\n  [") << u << ',' << v << ']';
+                first = false;
+            }
+        }
+    }
+    os << "\n]\n}\n";
+}
+
+/**
+ * @brief Builds a Graph from a JSON stream using the SAX reader.
+ * @param is Source stream.
+ * @return The loaded Graph.
+ */
+Graph Graph::readJson(std::istream& is) {
+    Graph g;
+    GraphJsonReader reader(g);
+    nlohmann::json::sax_parse(is, &reader);
+    reader.finish();
+    return g;
+}
+
 /**
  * @brief Constructs a Graph instance from a JSON representation.
  * @param j JSON object containing users and edges arrays.
@@ -296,23 +555,77 @@ Graph Graph::fromJson(const nlohmann::json& j) {
         std::vector<std::string> tags = uj.at("tags").get<std::vector<std::string>>();
         std::string email = uj.at("email").get<std::string>();
         std::string password = uj.at("password").get<std::string>();
-        User* u = new User(id, name, age, city, tags, email, password);
-        g.users[id] = u;
+        g.setProfile(User(id, name, age, city, tags, email, password));
         g.usernames.insert(name);
     }
     // Inicializar nextId interno
     {
         uint64_t maxId = 0;
-        for (const auto& pair : g.users)
-            if (pair.first > maxId) maxId = pair.first;
+        for (const User* u : g.users)
+            if (u && u->id > maxId) maxId = u->id;
         g.nextId = maxId + 1;
     }
     // Aristas
+    std::vector<std::pair<uint64_t, uint64_t>> batch;
+    batch.reserve(j.at("edges").size());
     for (const auto& ej : j.at("edges")) {
         uint64_t u = ej.at(0).get<uint64_t>();
         uint64_t v = ej.at(1).get<uint64_t>();
-        g.addEdge(static_cast<int>(u), static_cast<int>(v));
+        batch.emplace_back(u, v);
     }
+    g.addEdges(batch);
+    return g;
+}
+
+/**
+ * @brief Writes the graph to a binary snapshot.
+ * @param path Destination file path.
+ */
+void Graph::saveBinary(const std::string& path) const {
+    MappedSnapshot::write(path, *snapshot(), ids, users);
+}
+
+/**
+ * @brief Loads a graph from a binary snapshot, reusing the mapped CSR.
+ * @param path Path to the snapshot file.
+ * @return The loaded Graph.
+ * @throws runtime_error if the snapshot is missing, corrupt or repeats a user ID.
+ */
+Graph Graph::loadBinary(const std::string& path) {
+    MappedSnapshot snap(path);
+    Graph g;
+    uint32_t n = snap.numVertices();
+    // Mismo orden de índices densos que al guardar
+    g.ids.reserve(n);
+    for (uint32_t v = 0; v < n; ++v) {
+        g.ids.intern(snap.externalId(v));
+        // Un ID repetido fusionaría dos vértices y dejaría filas sin dueño
+        if (g.ids.size() != v + 1)
+            throw std::runtime_error("Snapshot corrupto (ID de usuario repetido): " + path);
+    }
+    g.users.resize(n, nullptr);
+
+    uint64_t maxId = 0;
+    for (std::size_t i = 0; i < snap.numUsers(); ++i) {
+        User* u = g.setProfile(snap.user(i));
+        g.usernames.insert(u->name);
+        if (u->id > maxId) maxId = u->id;
+    }
+    g.nextId = maxId + 1;
+
+    // Adyacencia mutable: MappedSnapshot ya verificó filas ordenadas, sin lazos y simétricas
+    std::shared_ptr<const CsrGraph> csr = snap.graph();
+    const uint32_t* off = csr->rowOffsets();
+    const uint32_t* nb = csr->neighborArray();
+    g.adj.resize(n);
+    for (uint32_t v = 0; v < n; ++v) {
+        if (off[v + 1] == off[v]) continue;
+        g.adj[v].mergeSorted(nb + off[v], off[v + 1] - off[v]);
+        ++g.active;
+    }
+    g.edges = static_cast<int>(off[n] / 2);
+    g.csr = csr;
+    g.compsStale = true;
     return g;
 }
 
@@ -332,62 +645,94 @@ double Graph::averageDegree() const {
  * @return Maximum shortest-path length found.
  */
 int Graph::approximateDiameter(int samples) const {
-    std::vector<int> keys = adj.keySet();
-    int n = static_cast<int>(keys.size());
-    if (n == 0) return 0;
-    int m = std::min(samples, n);
-    int diam = 0;
-    for (int i = 0; i < m; ++i) {
-        int start = keys[i];
-        // BFS para distancias desde start
-        std::unordered_map<int,int> dist;
-        std::queue<int> q;
-        dist[start] = 0;
-        q.push(start);
-        while (!q.empty()) {
-            int u = q.front(); q.pop();
-            LinkedList* neigh = adj.get(u);
-            if (!neigh) continue;
-            for (Node* p = neigh->begin(); p; p = p->next) {
-                int v = p->key;
-                if (!dist.count(v)) {
-                    dist[v] = dist[u] + 1;
-                    q.push(v);
-                    diam = std::max(diam, dist[v]);
-                }
-            }
-        }
+    return snapshot()->approximateDiameter(samples);
+}
+
+/**
+ * @brief Computes the exact diameter of the current snapshot.
+ * @return Diameter and work counters.
+ */
+DiameterStats Graph::exactDiameter() const {
+    return ::exactDiameter(*snapshot());
+}
+
+/**
+ * @brief Computes a user's eccentricity with one BfsEngine run.
+ * @param u User ID.
+ * @return Eccentricity, or -1 if unknown.
+ */
+int Graph::eccentricity(uint64_t u) const {
+    uint32_t i = ids.find(u);
+    if (i == IdMap::NONE) return -1;
+    std::shared_ptr<const CsrGraph> view = snapshot();
+    BfsEngine bfs;
+    return static_cast<int>(bfs.run(*view, i));
+}
+
+/**
+ * @brief Computes a source × target distance matrix with the multi-source BFS.
+ * @param sources Source user IDs.
+ * @param targets Target user IDs.
+ * @return Distance matrix (-1 if unreachable or unknown).
+ */
+std::vector<std::vector<int>> Graph::distances(const std::vector<uint64_t>& sources,
+                                               const std::vector<uint64_t>& targets) const {
+    std::vector<std::vector<int>> out(sources.size(), std::vector<int>(targets.size(), -1));
+    // Solo usuarios conocidos entran al barrido
+    std::vector<uint32_t> src, dst;
+    std::vector<std::size_t> srcRow, dstCol;
+    for (std::size_t i = 0; i < sources.size(); ++i) {
+        uint32_t v = ids.find(sources[i]);
+        if (v != IdMap::NONE) { src.push_back(v); srcRow.push_back(i); }
+    }
+    for (std::size_t j = 0; j < targets.size(); ++j) {
+        uint32_t v = ids.find(targets[j]);
+        if (v != IdMap::NONE) { dst.push_back(v); dstCol.push_back(j); }
     }
-    return diam;
+    if (src.empty() || dst.empty()) return out;
+    std::shared_ptr<const CsrGraph> view = snapshot();
+    MultiSourceBfs bfs(*view);
+    std::vector<int> flat = bfs.distances(src, dst);
+    for (std::size_t i = 0; i < src.size(); ++i)
+        for (std::size_t j = 0; j < dst.size(); ++j)
+            out[srcRow[i]][dstCol[j]] = flat[i * dst.size() + j];
+    return out;
 }
 
 /**
- * @brief Computes the average clustering coefficient of the graph.
- * @return Mean clustering coefficient across all vertices.
+ * @brief Computes the average clustering coefficient from the snapshot's triangle counts.
+ * @return Mean clustering coefficient across vertices with at least 2 friends.
  */
 double Graph::averageClusteringCoefficient() const {
-    std::vector<int> keys = adj.keySet();
-    double sumC = 0.0;
-    int count = 0;
-    for (int u : keys) {
-        LinkedList* neigh = adj.get(u);
-        if (!neigh) continue;
-        std::vector<int> vs;
-        for (Node* p = neigh->begin(); p; p = p->next)
-            vs.push_back(p->key);
-        int k = static_cast<int>(vs.size());
-        if (k < 2) continue;
-        int links = 0;
-        for (int i = 0; i < k; ++i) {
-            for (int j = i + 1; j < k; ++j) {
-                if (areFriends(vs[i], vs[j])) ++links;
-            }
-        }
-        double possible = k * (k - 1) / 2.0;
-        sumC += (links / possible);
-        ++count;
-    }
-    return (count > 0) ? (sumC / count) : 0.0;
+    return snapshot()->averageClusteringCoefficient();
+}
+
+/**
+ * @brief Computes the local clustering coefficient of a user.
+ * @param u User ID.
+ * @return Local coefficient, 0 if unknown or with fewer than 2 friends.
+ */
+double Graph::localClustering(uint64_t u) const {
+    uint32_t i = ids.find(u);
+    if (i == IdMap::NONE) return 0.0;
+    std::shared_ptr<const CsrGraph> view = snapshot();
+    return view->triangles().local(i, view->degree(i));
+}
+
+/**
+ * @brief Returns the global clustering coefficient.
+ * @return Transitivity of the graph.
+ */
+double Graph::transitivity() const {
+    return snapshot()->triangles().transitivity;
+}
+
+/**
+ * @brief Returns the number of triangles in the graph.
+ * @return Triangle count.
+ */
+uint64_t Graph::triangleCount() const {
+    return snapshot()->triangles().total;
 }
 
 #include <vector>
@@ -397,100 +742,265 @@ double Graph::averageClusteringCoefficient() const {
  * @return A vector of user IDs.
  */
 std::vector<uint64_t> Graph::getUserIds() const {
-    std::vector<uint64_t> ids;
-    ids.reserve(users.size());
-    for (const auto& kv : users) {
-        ids.push_back(kv.first);
+    std::vector<uint64_t> out;
+    out.reserve(users.size());
+    for (const User* u : users) {
+        if (u) out.push_back(u->id);
     }
-    return ids;
+    return out;
 }
 
 /**
  * @brief Adds a new post for a user.
  * @param userId The ID of the user making the post.
  * @param text The content of the post.
+ * @return The new post's ID.
  */
-void Graph::addPost(uint64_t userId, const std::string& text) {
-    Post p;
-    p.userId = userId;
-    p.text = text;
-    p.timestamp = std::time(nullptr);
-    posts.push_back(std::move(p));
+uint64_t Graph::addPost(uint64_t userId, const std::string& text) {
+    uint64_t id = posts.add(userId, text, std::time(nullptr));
+    if (timelines) fanOut(userId, id);
+    return id;
 }
 
 /**
- * @brief Retrieves all posts made by a specific user.
- * @param userId The user ID whose posts to retrieve.
- * @return Vector of Post objects for the user.
+ * @brief Looks up a post by ID in O(1).
+ * @param postId Post ID.
+ * @return The post, or nullptr if unknown.
  */
+const Post* Graph::getPost(uint64_t postId) const {
+    return posts.get(postId);
+}
 
+/**
+ * @brief Retrieves all posts made by a specific user from the per-author index.
+ * @param userId The user ID whose posts to retrieve.
+ * @return Vector of Post objects for the user, oldest first.
+ */
 std::vector<Post> Graph::getPostsForUser(uint64_t userId) const {
+    const std::vector<uint64_t>& mine = posts.byAuthor(userId);
     std::vector<Post> result;
-    for (const auto& p : posts) {
-        if (p.userId == userId) {
-            result.push_back(p);
-        }
-    }
+    result.reserve(mine.size());
+    for (uint64_t id : mine) result.push_back(*posts.get(id));
     return result;
 }
 
 /**
- * @brief Increments like count for a specific post.
- * @param userId ID of the user who made the post.
- * @param timestamp Timestamp of the post to like.
+ * @brief Returns a view over a user's post IDs in the per-author index.
+ * @param userId The author's user ID.
+ * @return Post IDs, oldest first.
  */
-void Graph::likePost(uint64_t userId, std::time_t timestamp) {
-    for (auto& p : posts) {
-        if (p.userId == userId && p.timestamp == timestamp) {
-            ++p.likes;
-            return;
-        }
-    }
+IdSpan Graph::postIdsOf(uint64_t userId) const {
+    const std::vector<uint64_t>& mine = posts.byAuthor(userId);
+    return {mine.data(), mine.data() + mine.size()};
+}
+
+/**
+ * @brief Increments like count for a specific post and its author's like total.
+ * @param postId ID of the post to like.
+ * @return false if the post does not exist.
+ */
+bool Graph::likePost(uint64_t postId) {
+    Post* p = posts.get(postId);
+    if (!p) return false;
+    ++p->likes;
+    int author = static_cast<int>(boardKeys.intern(p->userId));
+    likeBoard.insert(author, likeBoard.score(author) + 1);
+    return true;
 }
 
 /**
  * @brief Adds a comment to a specific post.
- * @param userId ID of the user who made the post.
- * @param timestamp Timestamp of the post to comment on.
+ * @param postId ID of the post to comment on.
  * @param text The comment text.
+ * @return false if the post does not exist.
+ */
+bool Graph::addComment(uint64_t postId, const std::string& text) {
+    return posts.addComment(postId, text, std::time(nullptr));
+}
+
+/**
+ * @brief Reads one page of a post's comments from the comment table.
+ * @param postId Post ID.
+ * @param limit Maximum number of comments in the page.
+ * @param cursor 0 for the first page, otherwise the previous page's next.
+ * @return The page, oldest first.
  */
+CommentPage Graph::getComments(uint64_t postId, std::size_t limit, uint64_t cursor) const {
+    return posts.comments(postId, limit, cursor);
+}
+
+/**
+ * @brief Reports the memory held by posts and comments.
+ * @return Byte counts of the post store.
+ */
+PostStoreStats Graph::postStats() const {
+    return posts.stats();
+}
 
-void Graph::addComment(uint64_t userId, std::time_t timestamp, const std::string& text) {
-    for (auto& p : posts) {
-        if (p.userId == userId && p.timestamp == timestamp) {
-            p.comments.emplace_back(text, std::time(nullptr));
-            return;
+/**
+ * @brief Lists the authors whose posts make up a user's feed.
+ * @param userId The user ID.
+ * @param out Receives the user, their friends and the users they follow (may repeat).
+ */
+void Graph::feedAuthors(uint64_t userId, std::vector<uint64_t>& out) const {
+    out.clear();
+    out.push_back(userId);
+    uint32_t iu = ids.find(userId);
+    if (iu != IdMap::NONE && iu < adj.size())
+        for (uint32_t w : adj[iu]) out.push_back(ids.external(w));
+    auto it = followingMap_.find(userId);
+    if (it != followingMap_.end()) out.insert(out.end(), it->second.begin(), it->second.end());
+}
+
+/**
+ * @brief Merges one page of a user's feed into m.out.
+ *
+ * With the timeline cache the page comes from the reader's ring plus its own
+ * and celebrity posts; whatever the ring dropped below its floor is pulled
+ * from the per-author lists. All buffers belong to m and are reused.
+ * @param m Merge buffers (the graph's own for forEachFeedPost, a local one otherwise).
+ * @param userId The ID of the user whose feed to get.
+ * @param limit Maximum number of posts in the page.
+ * @param cursor 0 for the first page, otherwise the previous page's next.
+ * @return true if older posts remain.
+ */
+bool Graph::mergeFeedInto(FeedMerger& m, uint64_t userId, std::size_t limit, uint64_t cursor) const {
+    uint32_t r = ids.find(userId);
+    if (timelines && r != IdMap::NONE && !timelines->fresh(r)) refillTimeline(m, r, userId);   // también usa m
+    m.out.clear();
+    if (timelines && r != IdMap::NONE) {
+
+        // El anillo, más los posts propios, los de celebridades y los de autores sin
+        // índice interno (solo seguidos), que no se difunden
+        m.runs.clear();
+        uint64_t floor = timelines->runs(r, m.runs);
+        if (!(floor && cursor && cursor <= floor)) {    // si no, la página es más antigua que el anillo
+            auto pullRun = [&](uint64_t author) {
+                const std::vector<uint64_t>& l = posts.byAuthor(author);
+                if (!l.empty()) m.runs.push_back({l.data(), l.size()});
+            };
+            pullRun(userId);
+            feedAuthors(userId, m.authors);
+            for (uint64_t a : m.authors) {
+                uint32_t ia = ids.find(a);
+                if (a != userId && (ia == IdMap::NONE || timelines->isCelebrity(ia))) pullRun(a);
+            }
+            bool more = m.merge(limit, cursor, floor);
+            if (!floor) return more;
+
+            // El anillo perdió posts antiguos: lo que falte por debajo de floor sale del pull
+            if (m.out.size() == limit) return true;
+            limit -= m.out.size();
+            cursor = floor;
         }
     }
+    m.runs.clear();
+    feedAuthors(userId, m.authors);
+    m.addAuthors(posts, m.authors);
+    return m.merge(limit, cursor);
 }
 
 /**
- * @brief Retrieves the feed posts for a user (own posts and those of friends).
+ * @brief Retrieves the whole feed of a user (own posts, friends' and followees').
  * @param userId The ID of the user whose feed to get.
- * @return Vector of Post objects for the feed.
+ * @return Copies of the feed posts, newest first.
  */
-
 std::vector<Post> Graph::getFeed(uint64_t userId) const {
+    FeedMerger m;                                       // local: sin estado compartido entre llamadas
+    mergeFeedInto(m, userId, posts.size(), 0);
     std::vector<Post> feed;
-    // Add own posts
-    for (const auto& p : posts) {
-        if (p.userId == userId) {
-            feed.push_back(p);
-        }
+    feed.reserve(m.out.size());
+    for (uint64_t id : m.out) feed.push_back(*posts.get(id));
+    return feed;
+}
+
+/**
+ * @brief Merges one page of a user's feed with local buffers.
+ * @param userId The ID of the user whose feed to get.
+ * @param limit Maximum number of posts in the page.
+ * @param cursor 0 for the first page, otherwise the previous page's next.
+ * @return Page of post IDs, newest first.
+ */
+FeedPage Graph::feedPage(uint64_t userId, std::size_t limit, uint64_t cursor) const {
+    FeedMerger m;                                       // local: sin estado compartido entre llamadas
+    FeedPage page;
+    page.more = mergeFeedInto(m, userId, limit, cursor);
+    page.posts.swap(m.out);
+    page.next = page.posts.empty() ? cursor : page.posts.back();
+    return page;
+}
+
+/**
+ * @brief Pushes a new post into the rings of its author's friends and followers.
+ *
+ * Authors whose audience exceeds the celebrity threshold are flagged once
+ * and for all and skipped; readers pull their posts at read time.
+ * @param author Author's user ID.
+ * @param postId New post ID.
+ */
+void Graph::fanOut(uint64_t author, uint64_t postId) {
+    uint32_t a = ids.find(author);
+    if (a == IdMap::NONE) return;                       // sin índice: sus lectores lo leen por pull
+    auto fit = followersMap_.find(author);
+    std::size_t followers = fit == followersMap_.end() ? 0 : fit->second.size();
+    std::size_t friends = a < adj.size() ? adj[a].size() : 0;
+    if (timelines->isCelebrity(a) || friends + followers > timelines->config().celebrityThreshold) {
+        timelines->markCelebrity(a);
+        timelines->countPulled();
+        return;
     }
-    // Add posts from direct friends
-    LinkedList* neigh = adj.get(static_cast<int>(userId));
-    if (neigh) {
-        for (Node* n = neigh->begin(); n; n = n->next) {
-            uint64_t friendId = n->key;
-            for (const auto& p : posts) {
-                if (p.userId == friendId) {
-                    feed.push_back(p);
-                }
-            }
+    if (friends)
+        for (uint32_t w : adj[a]) timelines->push(w, postId);
+    if (followers)
+        for (uint64_t f : fit->second) {
+            uint32_t fi = ids.find(f);
+            if (fi != IdMap::NONE) timelines->push(fi, postId);
         }
-    }
-    return feed;
+}
+
+/**
+ * @brief Refills a reader's ring with the newest posts of its non-celebrity sources.
+ * @param m Merge buffers to use.
+ * @param reader Reader's internal index.
+ * @param userId Reader's user ID.
+ */
+void Graph::refillTimeline(FeedMerger& m, uint32_t reader, uint64_t userId) const {
+    feedAuthors(userId, m.authors);
+    // Solo las fuentes que se difunden: ni el propio lector, ni las celebridades,
+    // ni los autores sin índice interno
+    m.authors.erase(std::remove_if(m.authors.begin(), m.authors.end(), [&](uint64_t a) {
+        uint32_t ia = ids.find(a);
+        return a == userId || ia == IdMap::NONE || timelines->isCelebrity(ia);
+    }), m.authors.end());
+    m.runs.clear();
+    m.out.clear();
+    m.addAuthors(posts, m.authors);
+    bool more = m.merge(timelines->config().capacity);
+    timelines->rebuild(reader, m.out, !more);
+}
+
+/**
+ * @brief Marks a reader's ring stale after a follow change.
+ * @param userId Reader's user ID.
+ */
+void Graph::invalidateTimeline(uint64_t userId) {
+    uint32_t r = ids.find(userId);
+    if (timelines && r != IdMap::NONE) timelines->invalidate(r);
+}
+
+/**
+ * @brief Creates (or resets) the timeline cache.
+ * @param config Ring capacity and celebrity threshold.
+ */
+void Graph::enableTimelineCache(const TimelineConfig& config) {
+    timelines.reset(new TimelineCache(config));
+}
+
+/**
+ * @brief Drops the timeline cache.
+ */
+void Graph::disableTimelineCache() {
+    timelines.reset();
 }
 
 // For std::remove, std::find, etc.
@@ -508,7 +1018,10 @@ void Graph::follow(uint64_t followerId, uint64_t followeeId) {
     if (std::find(followList.begin(), followList.end(), followeeId) == followList.end()) {
         followList.push_back(followeeId);
         // Also update followers map
-        followersMap_[followeeId].push_back(followerId);
+        std::vector<uint64_t>& followers = followersMap_[followeeId];
+        followers.push_back(followerId);
+        followerBoard.insert(static_cast<int>(boardKeys.intern(followeeId)), static_cast<int>(followers.size()));
+        invalidateTimeline(followerId);
     }
 }
 
@@ -526,7 +1039,14 @@ void Graph::unfollow(uint64_t followerId, uint64_t followeeId) {
     auto itR = followersMap_.find(followeeId);
     if (itR != followersMap_.end()) {
         auto& revList = itR->second;
+        std::size_t before = revList.size();
         revList.erase(std::remove(revList.begin(), revList.end(), followerId), revList.end());
+        if (revList.size() != before) {
+            invalidateTimeline(followerId);
+            int idx = static_cast<int>(boardKeys.find(followeeId));
+            if (revList.empty()) followerBoard.erase(idx);
+            else followerBoard.update(idx, static_cast<int>(revList.size()));
+        }
     }
 }
 
@@ -552,6 +1072,81 @@ std::vector<uint64_t> Graph::getFollowing(uint64_t userId) const {
     return it->second;
 }
 
+/**
+ * @brief Returns a view over the followers of a user.
+ * @param userId User ID whose followers to get.
+ * @return Follower IDs (empty if none).
+ */
+IdSpan Graph::followersOf(uint64_t userId) const {
+    auto it = followersMap_.find(userId);
+    if (it == followersMap_.end()) return {};
+    return {it->second.data(), it->second.data() + it->second.size()};
+}
+
+/**
+ * @brief Returns a view over the users a given user follows.
+ * @param userId User ID whose followees to get.
+ * @return Followed user IDs (empty if none).
+ */
+IdSpan Graph::followingOf(uint64_t userId) const {
+    auto it = followingMap_.find(userId);
+    if (it == followingMap_.end()) return {};
+    return {it->second.data(), it->second.data() + it->second.size()};
+}
+
+namespace {
+
+/// Convierte las primeras k entradas de un ranking a pares (ID externo, puntaje).
+std::vector<std::pair<uint64_t, int>> leaderboard(const AVLTree& board, const IdMap& keys, int k) {
+    std::vector<std::pair<uint64_t, int>> out;
+    for (int v : board.topK(k)) out.emplace_back(keys.external(static_cast<uint32_t>(v)), board.score(v));
+    return out;
+}
+
+/// Posición de un usuario en un ranking (-1 si no figura).
+int boardRank(const AVLTree& board, const IdMap& keys, uint64_t u) {
+    uint32_t i = keys.find(u);
+    return i == IdMap::NONE ? -1 : board.rank(static_cast<int>(i));
+}
+
+} // namespace
+
+/**
+ * @brief Reads the top of the follower leaderboard, kept up to date by follow/unfollow.
+ * @param k Maximum number of entries.
+ * @return Pairs (user ID, follower count), highest first.
+ */
+std::vector<std::pair<uint64_t, int>> Graph::mostFollowed(int k) const {
+    return leaderboard(followerBoard, boardKeys, k);
+}
+
+/**
+ * @brief Reads the top of the like leaderboard, kept up to date by likePost.
+ * @param k Maximum number of entries.
+ * @return Pairs (user ID, total likes), highest first.
+ */
+std::vector<std::pair<uint64_t, int>> Graph::mostLiked(int k) const {
+    return leaderboard(likeBoard, boardKeys, k);
+}
+
+/**
+ * @brief Returns a user's rank by follower count in O(log n).
+ * @param u User ID.
+ * @return 1-based rank, or -1 if the user has no followers.
+ */
+int Graph::followerRank(uint64_t u) const {
+    return boardRank(followerBoard, boardKeys, u);
+}
+
+/**
+ * @brief Returns a user's rank by likes received in O(log n).
+ * @param u User ID.
+ * @return 1-based rank, or -1 if the user has no likes.
+ */
+int Graph::likeRank(uint64_t u) const {
+    return boardRank(likeBoard, boardKeys, u);
+}
+
 /**
  * @brief Finds users whose names contain the given substring (case-insensitive).
  * @param name Partial or full username to search.
@@ -561,8 +1156,8 @@ std::vector<std::pair<uint64_t, std::string>> Graph::findUsersByName(const std::
     std::vector<std::pair<uint64_t, std::string>> results;
     std::string lower = name;
     std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
-    for (const auto& kv : users) {
-        const User* u = kv.second;
+    for (const User* u : users) {
+        if (!u) continue;
         std::string uname = u->name;
         std::string unameLower = uname;
         std::transform(unameLower.begin(), unameLower.end(), unameLower.begin(), ::tolower);
@@ -1,29 +1,26 @@
 /**
  * @file hash_table.cpp
- * @brief Implements the HashTable class for mapping integer keys to LinkedList values using open addressing and chaining.
+ * @brief Implements the HashTable class for mapping integer keys to LinkedList values using open addressing with SIMD-scanned control bytes.
  */
-#include <cassert>
 #include "../include/hash_table.h"
-#include <vector>
 #include <cstring>
-#include <stdexcept>
+#include <utility>
 #include "../include/linked_list.h"
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 /**
  * @brief Constructs a HashTable with given capacity and load factor.
- * @param cap Initial number of buckets.
+ * @param cap Initial number of buckets (rounded up to a power of two).
  * @param load Maximum load factor before rehashing.
  */
 HashTable::HashTable(int cap, float load)
-    : capacity(cap), sz(0), maxLoad(load) {
-    keys = new int[capacity];
-    values = new LinkedList*[capacity];
-    used = new bool[capacity];
-    for (int i = 0; i < capacity; ++i) {
-        keys[i] = EMPTY;
-        values[i] = nullptr;
-        used[i] = false;
-    }
+    : keys(nullptr), values(nullptr), ctrl(nullptr), capacity(0), minCapacity(GROUP),
+      sz(0), maxLoad(load) {
+    if (maxLoad > 0.875f) maxLoad = 0.875f;   // siempre debe quedar alguna celda libre
+    while (minCapacity < cap) minCapacity <<= 1;
+    allocate(minCapacity);
 }
 
 /**
@@ -31,70 +28,170 @@ HashTable::HashTable(int cap, float load)
  */
 HashTable::~HashTable() {
     for (int i = 0; i < capacity; ++i) {
-        if (used[i] && values[i]) delete values[i];
+        if (ctrl[i] != EMPTY && values[i]) delete values[i];
     }
     delete[] keys;
     delete[] values;
-    delete[] used;
+    delete[] ctrl;
 }
 
 /**
- * @brief Computes the hash index for a given key.
- * @param key The key to hash.
- * @return Hash index in the current table capacity.
- */
-int HashTable::hash(int key) const {
-    long long h = 0;
-    int k = key;
-    while (k > 0) {
-        int d = k % 10;
-        h = h * 37 + d;
-        k /= 10;
+ * @brief Takes ownership of another table's slots and values.
+ * @param other Table left empty after the move.
+ */
+HashTable::HashTable(HashTable&& other) noexcept
+    : keys(nullptr), values(nullptr), ctrl(nullptr), capacity(0), minCapacity(GROUP),
+      sz(0), maxLoad(other.maxLoad) {
+    allocate(GROUP);
+    *this = std::move(other);
+}
+
+/**
+ * @brief Releases the current contents and takes ownership of another table's.
+ * @param other Table left empty after the move.
+ * @return Reference to this table.
+ */
+HashTable& HashTable::operator=(HashTable&& other) noexcept {
+    if (this != &other) {
+        std::swap(keys, other.keys);
+        std::swap(values, other.values);
+        std::swap(ctrl, other.ctrl);
+        std::swap(capacity, other.capacity);
+        std::swap(minCapacity, other.minCapacity);
+        std::swap(sz, other.sz);
+        std::swap(maxLoad, other.maxLoad);
     }
-    if (h < 0) h = -h;
-    return static_cast<int>(h % capacity);
+    return *this;
+}
+
+/**
+ * @brief Allocates empty slot arrays of the given capacity.
+ * @param cap Number of slots (power of two, at least GROUP).
+ */
+void HashTable::allocate(int cap) {
+    capacity = cap;
+    keys = new int[capacity];
+    values = new LinkedList*[capacity];
+    ctrl = new int8_t[capacity + GROUP - 1];
+    std::memset(ctrl, EMPTY, capacity + GROUP - 1);
+    for (int i = 0; i < capacity; ++i) values[i] = nullptr;
+}
+
+/**
+ * @brief Mixes a key into a 64-bit hash (multiply / xor-shift).
+ *
+ * The low 7 bits become the control tag and the remaining bits pick the
+ * home slot, so negative keys, zero and sequential IDs all spread evenly.
+ * @param key The key to hash.
+ * @return 64-bit hash value.
+ */
+uint64_t HashTable::hash(int key) {
+    uint64_t x = static_cast<uint32_t>(key);
+    x *= 0x9e3779b97f4a7c15ULL;
+    x ^= x >> 32;
+    x *= 0xd6e8feb86659fd93ULL;
+    x ^= x >> 32;
+    return x;
 }
 
 /**
- * @brief Finds the slot for a key using linear probing.
+ * @brief Finds slots in a 16-slot group whose control byte equals a tag.
+ * @param pos First slot of the group.
+ * @param tag Control byte to compare against.
+ * @return Bit mask where bit i marks slot pos+i.
+ */
+uint32_t HashTable::matchGroup(int pos, int8_t tag) const {
+#if defined(__SSE2__)
+    __m128i g = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl + pos));
+    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(g, _mm_set1_epi8(tag))));
+#else
+    uint32_t m = 0;
+    for (int i = 0; i < GROUP; ++i)
+        if (ctrl[pos + i] == tag) m |= 1u << i;
+    return m;
+#endif
+}
+
+/**
+ * @brief Finds free slots in a 16-slot group.
+ * @param pos First slot of the group.
+ * @return Bit mask where bit i marks an empty slot pos+i.
+ */
+uint32_t HashTable::emptyGroup(int pos) const {
+#if defined(__SSE2__)
+    // Solo EMPTY tiene el bit de signo activo
+    __m128i g = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl + pos));
+    return static_cast<uint32_t>(_mm_movemask_epi8(g));
+#else
+    return matchGroup(pos, EMPTY);
+#endif
+}
+
+/**
+ * @brief Writes a control byte, mirroring the first GROUP-1 slots past the end.
+ * @param idx Slot index.
+ * @param tag Control byte to store.
+ */
+void HashTable::setCtrl(int idx, int8_t tag) {
+    ctrl[idx] = tag;
+    if (idx < GROUP - 1) ctrl[capacity + idx] = tag;
+}
+
+/**
+ * @brief Computes the home slot of a key for the current capacity.
+ * @param key The key.
+ * @return Index where the key's probe chain starts.
+ */
+int HashTable::home(int key) const {
+    return static_cast<int>((hash(key) >> 7) & (capacity - 1));
+}
+
+/**
+ * @brief Finds the slot holding a key using group-wise linear probing.
  * @param key The key to probe.
- * @return Index of the slot where the key is or should be.
+ * @return Index of the slot where the key is, or -1 if absent.
  */
 int HashTable::probe(int key) const {
-    int idx = hash(key);
-    while (used[idx] && keys[idx] != key) {
-        idx = (idx + 1) % capacity;
+    uint64_t h = hash(key);
+    int8_t tag = static_cast<int8_t>(h & 0x7f);
+    int mask = capacity - 1;
+    int pos = static_cast<int>((h >> 7) & mask);
+    while (true) {
+        for (uint32_t m = matchGroup(pos, tag); m; m &= m - 1) {
+            int idx = (pos + __builtin_ctz(m)) & mask;
+            if (keys[idx] == key) return idx;
+        }
+        if (emptyGroup(pos)) return -1;   // la cadena termina en esta celda libre
+        pos = (pos + GROUP) & mask;
     }
-    return idx;
 }
 
 /**
  * @brief Resizes the table and reinserts all existing key-value pairs.
+ * @param newCap New number of slots (power of two).
  */
-void HashTable::rehash() {
+void HashTable::rehash(int newCap) {
     int oldCap = capacity;
     int* oldKeys = keys;
     LinkedList** oldVals = values;
-    bool* oldUsed = used;
+    int8_t* oldCtrl = ctrl;
 
-    capacity = capacity * 2 + 1;
-    keys = new int[capacity];
-    values = new LinkedList*[capacity];
-    used = new bool[capacity];
-    for (int i = 0; i < capacity; ++i) {
-        keys[i] = EMPTY;
-        values[i] = nullptr;
-        used[i] = false;
-    }
-    sz = 0;
+    allocate(newCap);
+    int mask = capacity - 1;
     for (int i = 0; i < oldCap; ++i) {
-        if (oldUsed[i]) {
-            put(oldKeys[i], oldVals[i]); // reinserta
-        }
+        if (oldCtrl[i] == EMPTY) continue;
+        uint64_t h = hash(oldKeys[i]);
+        int pos = static_cast<int>((h >> 7) & mask);
+        uint32_t e;
+        while (!(e = emptyGroup(pos))) pos = (pos + GROUP) & mask;
+        int idx = (pos + __builtin_ctz(e)) & mask;
+        keys[idx] = oldKeys[i];
+        values[idx] = oldVals[i];
+        setCtrl(idx, static_cast<int8_t>(h & 0x7f));
     }
     delete[] oldKeys;
     delete[] oldVals;
-    delete[] oldUsed;
+    delete[] oldCtrl;
 }
 
 /**
@@ -104,8 +201,7 @@ void HashTable::rehash() {
  */
 LinkedList* HashTable::get(int key) const {
     int idx = probe(key);
-    if (!used[idx]) return nullptr;
-    return values[idx];
+    return idx < 0 ? nullptr : values[idx];
 }
 
 /**
@@ -115,20 +211,62 @@ LinkedList* HashTable::get(int key) const {
  */
 void HashTable::put(int key, LinkedList* value) {
     int idx = probe(key);
-    if (!used[idx]) {
-        // nueva clave
-        keys[idx] = key;
-        used[idx] = true;
-        values[idx] = value;
-        ++sz;
-        if (static_cast<float>(sz) / capacity > maxLoad) rehash();
-    } else {
+    if (idx >= 0) {
         // clave existente: actualiza valor
         if (values[idx] != value) {
             if (values[idx]) delete values[idx];
             values[idx] = value;
         }
+        return;
     }
+    // nueva clave: crecer antes de superar el factor de carga
+    if (static_cast<float>(sz + 1) / capacity > maxLoad) rehash(capacity * 2);
+
+    uint64_t h = hash(key);
+    int mask = capacity - 1;
+    int pos = static_cast<int>((h >> 7) & mask);
+    uint32_t e;
+    while (!(e = emptyGroup(pos))) pos = (pos + GROUP) & mask;
+    idx = (pos + __builtin_ctz(e)) & mask;
+    keys[idx] = key;
+    values[idx] = value;
+    setCtrl(idx, static_cast<int8_t>(h & 0x7f));
+    ++sz;
+}
+
+/**
+ * @brief Removes a key with backward-shift deletion, shrinking the table if sparse.
+ *
+ * Every later entry of the same probe chain whose home slot does not lie
+ * between the hole and its own slot is moved back into the hole, so lookups
+ * still stop at the first empty slot and no tombstones are needed.
+ * @param key The key to remove.
+ * @return True if the key was present.
+ */
+bool HashTable::remove(int key) {
+    int idx = probe(key);
+    if (idx < 0) return false;
+    delete values[idx];
+
+    int mask = capacity - 1;
+    int hole = idx;
+    for (int j = (idx + 1) & mask; ctrl[j] != EMPTY; j = (j + 1) & mask) {
+        // distancia desde su celda inicial ≥ distancia desde el hueco: puede retroceder
+        int h = home(keys[j]);
+        if (((j - h) & mask) >= ((j - hole) & mask)) {
+            keys[hole] = keys[j];
+            values[hole] = values[j];
+            setCtrl(hole, ctrl[j]);
+            hole = j;
+        }
+    }
+    values[hole] = nullptr;
+    setCtrl(hole, EMPTY);
+    --sz;
+
+    // encoger si la ocupación cae por debajo de un cuarto del límite
+    if (capacity > minCapacity && sz < capacity * maxLoad / 4) rehash(capacity / 2);
+    return true;
 }
 
 /**
@@ -137,8 +275,17 @@ void HashTable::put(int key, LinkedList* value) {
  * @return True if the key exists, false otherwise.
  */
 bool HashTable::containsKey(int key) const {
-    int idx = probe(key);
-    return used[idx];
+    return probe(key) >= 0;
+}
+
+/**
+ * @brief Grows the table once so that n keys fit under the load limit.
+ * @param n Expected number of keys.
+ */
+void HashTable::reserve(int n) {
+    int cap = capacity;
+    while (cap * maxLoad < n) cap *= 2;
+    if (cap > capacity) rehash(cap);
 }
 
 /**
@@ -148,6 +295,6 @@ bool HashTable::containsKey(int key) const {
 std::vector<int> HashTable::keySet() const {
     std::vector<int> v;
     v.reserve(sz);
-    for (int i = 0; i < capacity; ++i) if (used[i]) v.push_back(keys[i]);
+    for (int i = 0; i < capacity; ++i) if (ctrl[i] != EMPTY) v.push_back(keys[i]);
     return v;
-}
\ No newline at end of file
+}
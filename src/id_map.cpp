@@ -0,0 +1,82 @@
+/**
+ * @file id_map.cpp
+ * @brief Implements IdMap, the external-ID → dense-index dictionary.
+ */
+#include "../include/id_map.h"
+
+/**
+ * @brief Constructs an empty map with a small initial table.
+ */
+IdMap::IdMap() : slotKeys(16), slotVals(16, NONE), mask(15) {}
+
+/**
+ * @brief Scrambles a 64-bit key so consecutive IDs spread across the table.
+ * @param x Key to mix.
+ * @return Mixed hash value.
+ */
+uint64_t IdMap::mix(uint64_t x) {
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+/**
+ * @brief Resizes the open table and reinserts every interned ID.
+ * @param cap New capacity (power of two).
+ */
+void IdMap::rebuild(std::size_t cap) {
+    slotKeys.assign(cap, 0);
+    slotVals.assign(cap, NONE);
+    mask = cap - 1;
+    for (uint32_t v = 0; v < ext.size(); ++v) {
+        std::size_t i = mix(ext[v]) & mask;
+        while (slotVals[i] != NONE) i = (i + 1) & mask;
+        slotKeys[i] = ext[v];
+        slotVals[i] = v;
+    }
+}
+
+/**
+ * @brief Returns the internal index of an external ID, assigning a new one if absent.
+ * @param id External user ID.
+ * @return Dense internal index.
+ */
+uint32_t IdMap::intern(uint64_t id) {
+    std::size_t i = mix(id) & mask;
+    while (slotVals[i] != NONE) {
+        if (slotKeys[i] == id) return slotVals[i];
+        i = (i + 1) & mask;
+    }
+    uint32_t v = static_cast<uint32_t>(ext.size());
+    slotKeys[i] = id;
+    slotVals[i] = v;
+    ext.push_back(id);
+    if (ext.size() * 2 > mask + 1) rebuild((mask + 1) * 2);     // factor de carga ≤ 0.5
+    return v;
+}
+
+/**
+ * @brief Looks up the internal index of an external ID.
+ * @param id External user ID.
+ * @return Dense internal index, or NONE if absent.
+ */
+uint32_t IdMap::find(uint64_t id) const {
+    std::size_t i = mix(id) & mask;
+    while (slotVals[i] != NONE) {
+        if (slotKeys[i] == id) return slotVals[i];
+        i = (i + 1) & mask;
+    }
+    return NONE;
+}
+
+/**
+ * @brief Pre-allocates room for at least n IDs.
+ * @param n Expected number of IDs.
+ */
+void IdMap::reserve(std::size_t n) {
+    ext.reserve(n);
+    std::size_t cap = mask + 1;
+    while (cap < n * 2) cap *= 2;
+    if (cap != mask + 1) rebuild(cap);
+}
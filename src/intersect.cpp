@@ -0,0 +1,179 @@
+/**
+ * @file intersect.cpp
+ * @brief Implements the scalar, galloping and AVX2 sorted-set intersection kernels.
+ */
+#include "../include/intersect.h"
+#include <utility>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define INTERSECT_X86 1
+#include <immintrin.h>
+#endif
+
+namespace {
+
+/// Mezcla lineal; Write decide si se escriben los comunes o solo se cuentan.
+template <bool Write>
+std::size_t mergeKernel(const uint32_t* a, std::size_t na, const uint32_t* b, std::size_t nb,
+                        uint32_t* out) {
+    std::size_t i = 0, j = 0, c = 0;
+    while (i < na && j < nb) {
+        uint32_t x = a[i], y = b[j];
+        if (Write && x == y) out[c] = x;
+        c += x == y;
+        i += x <= y;        // avanzar sin saltos impredecibles
+        j += y <= x;
+    }
+    return c;
+}
+
+/// Búsqueda exponencial de cada elemento de la lista corta en la larga.
+template <bool Write>
+std::size_t gallopKernel(const uint32_t* a, std::size_t na, const uint32_t* b, std::size_t nb,
+                         uint32_t* out) {
+    if (na > nb) { std::swap(a, b); std::swap(na, nb); }
+    std::size_t pos = 0, c = 0;
+    for (std::size_t i = 0; i < na && pos < nb; ++i) {
+        uint32_t x = a[i];
+        // Salto exponencial hasta pasar x, luego búsqueda binaria en el último tramo
+        std::size_t step = 1, lo = pos, hi = pos;
+        while (hi < nb && b[hi] < x) {
+            lo = hi + 1;
+            hi = pos + step;
+            step <<= 1;
+        }
+        if (hi > nb) hi = nb;
+        while (lo < hi) {
+            std::size_t mid = lo + (hi - lo) / 2;
+            if (b[mid] < x) lo = mid + 1; else hi = mid;
+        }
+        pos = lo;
+        if (pos < nb && b[pos] == x) {
+            if (Write) out[c] = x;
+            ++c;
+            ++pos;
+        }
+    }
+    return c;
+}
+
+#ifdef INTERSECT_X86
+/// Compara bloques de 8×8 con 8 rotaciones de b; la cola se termina con la mezcla escalar.
+template <bool Write>
+__attribute__((target("avx2")))
+std::size_t avx2Kernel(const uint32_t* a, std::size_t na, const uint32_t* b, std::size_t nb,
+                       uint32_t* out) {
+    std::size_t i = 0, j = 0, c = 0;
+    const __m256i rot = _mm256_setr_epi32(1, 2, 3, 4, 5, 6, 7, 0);
+    while (i + 8 <= na && j + 8 <= nb) {
+        __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + j));
+        __m256i m = _mm256_cmpeq_epi32(va, vb);
+        for (int r = 1; r < 8; ++r) {
+            vb = _mm256_permutevar8x32_epi32(vb, rot);
+            m = _mm256_or_si256(m, _mm256_cmpeq_epi32(va, vb));
+        }
+        unsigned mask = static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(m)));
+        if (Write) {
+            for (; mask; mask &= mask - 1) out[c++] = a[i + __builtin_ctz(mask)];
+        } else {
+            c += static_cast<std::size_t>(__builtin_popcount(mask));
+        }
+        uint32_t amax = a[i + 7], bmax = b[j + 7];
+        i += amax <= bmax ? 8 : 0;
+        j += bmax <= amax ? 8 : 0;
+    }
+    return c + mergeKernel<Write>(a + i, na - i, b + j, nb - j, Write ? out + c : out);
+}
+#endif
+
+/// true si conviene galopar: la lista larga supera GALLOP_RATIO veces a la corta.
+bool skewed(std::size_t na, std::size_t nb) {
+    std::size_t small = na < nb ? na : nb, large = na < nb ? nb : na;
+    return large / GALLOP_RATIO >= small;
+}
+
+} // namespace
+
+/**
+ * @brief Detects AVX2 once per process.
+ * @return true if AVX2 kernels are usable.
+ */
+bool intersectHasAvx2() {
+#ifdef INTERSECT_X86
+    static const bool ok = __builtin_cpu_supports("avx2");
+    return ok;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief Counts common elements with the kernel suited to the sizes and CPU.
+ */
+std::size_t intersectCount(const uint32_t* a, std::size_t na, const uint32_t* b, std::size_t nb) {
+    if (na == 0 || nb == 0) return 0;
+    if (skewed(na, nb)) return gallopKernel<false>(a, na, b, nb, nullptr);
+    return intersectCountAvx2(a, na, b, nb);
+}
+
+/**
+ * @brief Writes common elements with the kernel suited to the sizes and CPU.
+ */
+std::size_t intersect(const uint32_t* a, std::size_t na, const uint32_t* b, std::size_t nb,
+                      uint32_t* out) {
+    if (na == 0 || nb == 0) return 0;
+    if (skewed(na, nb)) return gallopKernel<true>(a, na, b, nb, out);
+    return intersectAvx2(a, na, b, nb, out);
+}
+
+/**
+ * @brief Scalar merge, count only.
+ */
+std::size_t intersectCountScalar(const uint32_t* a, std::size_t na, const uint32_t* b, std::size_t nb) {
+    return mergeKernel<false>(a, na, b, nb, nullptr);
+}
+
+/**
+ * @brief Scalar merge writing the common elements.
+ */
+std::size_t intersectScalar(const uint32_t* a, std::size_t na, const uint32_t* b, std::size_t nb,
+                            uint32_t* out) {
+    return mergeKernel<true>(a, na, b, nb, out);
+}
+
+/**
+ * @brief Galloping search, count only.
+ */
+std::size_t intersectCountGalloping(const uint32_t* a, std::size_t na, const uint32_t* b, std::size_t nb) {
+    return gallopKernel<false>(a, na, b, nb, nullptr);
+}
+
+/**
+ * @brief Galloping search writing the common elements.
+ */
+std::size_t intersectGalloping(const uint32_t* a, std::size_t na, const uint32_t* b, std::size_t nb,
+                               uint32_t* out) {
+    return gallopKernel<true>(a, na, b, nb, out);
+}
+
+/**
+ * @brief AVX2 block kernel (count only) or scalar merge without AVX2.
+ */
+std::size_t intersectCountAvx2(const uint32_t* a, std::size_t na, const uint32_t* b, std::size_t nb) {
+#ifdef INTERSECT_X86
+    if (intersectHasAvx2()) return avx2Kernel<false>(a, na, b, nb, nullptr);
+#endif
+    return mergeKernel<false>(a, na, b, nb, nullptr);
+}
+
+/**
+ * @brief AVX2 block kernel writing the common elements, or scalar merge without AVX2.
+ */
+std::size_t intersectAvx2(const uint32_t* a, std::size_t na, const uint32_t* b, std::size_t nb,
+                          uint32_t* out) {
+#ifdef INTERSECT_X86
+    if (intersectHasAvx2()) return avx2Kernel<true>(a, na, b, nb, out);
+#endif
+    return mergeKernel<true>(a, na, b, nb, out);
+}
@@ -0,0 +1,184 @@
+/**
+ * @file json_stream.cpp
+ * @brief Implements the SAX handler that streams a JSON network into a Graph.
+ */
+#include "../include/json_stream.h"
+#include "../include/graph.h"
+#include <stdexcept>
+
+namespace {
+
+/// Bits de los campos obligatorios de un usuario (todos salvo profilePic).
+const unsigned REQUIRED = 0x7F;
+
+[[noreturn]] void invalid(const std::string& what) {
+    throw std::runtime_error("JSON inválido: " + what);
+}
+
+} // namespace
+
+/**
+ * @brief Creates a reader that fills the given graph.
+ * @param g Destination graph.
+ */
+GraphJsonReader::GraphJsonReader(Graph& g) : g(g) {
+    batch.reserve(BATCH);
+}
+
+/**
+ * @brief Inserts the remaining edges and sets the graph's next free ID.
+ */
+void GraphJsonReader::finish() {
+    flush();
+    g.nextId = maxId + 1;
+}
+
+/**
+ * @brief Inserts the buffered edges into the graph.
+ */
+void GraphJsonReader::flush() {
+    if (batch.empty()) return;
+    g.addEdges(batch);
+    batch.clear();
+}
+
+/**
+ * @brief Stores the user whose object just closed.
+ */
+void GraphJsonReader::commitUser() {
+    if ((seen & REQUIRED) != REQUIRED) invalid("usuario sin todos los campos obligatorios");
+    g.setProfile(User(id, name, age, city, tags, email, password, profilePic));
+    g.usernames.insert(name);
+    if (id > maxId) maxId = id;
+}
+
+/**
+ * @brief Handles an integer value (user id, age or edge endpoint).
+ * @param v Absolute value.
+ * @param negative true if the value is negative.
+ * @return true to continue parsing.
+ */
+bool GraphJsonReader::integer(uint64_t v, bool negative) {
+    if (section == USERS && depth == 3) {
+        if (field == F_ID) {
+            if (negative) invalid("id negativo");
+            id = v;
+        } else if (field == F_AGE) {
+            age = negative ? -static_cast<int>(v) : static_cast<int>(v);
+        } else if (field != F_OTHER) {
+            invalid("tipo incorrecto en campo de usuario");
+        }
+        seen |= 1u << field;
+    } else if (section == EDGES && depth == 3) {
+        if (negative || pairLen == 2) invalid("arista mal formada");
+        pair[pairLen++] = v;
+    }
+    return true;
+}
+
+bool GraphJsonReader::number_integer(number_integer_t val) {
+    bool neg = val < 0;
+    return integer(neg ? 0 - static_cast<uint64_t>(val) : static_cast<uint64_t>(val), neg);
+}
+
+bool GraphJsonReader::number_unsigned(number_unsigned_t val) {
+    return integer(val, false);
+}
+
+bool GraphJsonReader::number_float(number_float_t val, const string_t&) {
+    if (section == USERS && depth == 3 && field == F_AGE) {
+        age = static_cast<int>(val);
+        seen |= 1u << F_AGE;
+    } else if ((section == USERS && depth == 3 && field != F_OTHER) || (section == EDGES && depth == 3)) {
+        invalid("número decimal inesperado");
+    }
+    return true;
+}
+
+bool GraphJsonReader::string(string_t& val) {
+    if (section == USERS && depth == 4 && field == F_TAGS) {
+        tags.push_back(std::move(val));
+        return true;
+    }
+    if (section == USERS && depth == 3) {
+        switch (field) {
+            case F_NAME:     name = std::move(val); break;
+            case F_CITY:     city = std::move(val); break;
+            case F_EMAIL:    email = std::move(val); break;
+            case F_PASSWORD: password = std::move(val); break;
+            case F_PIC:      profilePic = std::move(val); break;
+            case F_OTHER:    return true;
+            default:         invalid("tipo incorrecto en campo de usuario");
+        }
+        seen |= 1u << field;
+    } else if (section == EDGES && depth == 3) {
+        invalid("arista mal formada");
+    }
+    return true;
+}
+
+bool GraphJsonReader::null() { return true; }
+bool GraphJsonReader::boolean(bool) { return true; }
+bool GraphJsonReader::binary(binary_t&) { return true; }
+
+bool GraphJsonReader::start_object(std::size_t) {
+    if (section == USERS && depth == 2) {
+        // Nuevo usuario
+        seen = 0;
+        id = 0;
+        age = 0;
+        name.clear(); city.clear(); email.clear(); password.clear(); profilePic.clear();
+        tags.clear();
+        field = F_OTHER;
+    }
+    ++depth;
+    return true;
+}
+
+bool GraphJsonReader::end_object() {
+    if (section == USERS && depth == 3) commitUser();
+    --depth;
+    return true;
+}
+
+bool GraphJsonReader::start_array(std::size_t) {
+    if (section == USERS && depth == 3 && field == F_TAGS) {
+        seen |= 1u << F_TAGS;
+    } else if (section == EDGES && depth == 2) {
+        pairLen = 0;
+    }
+    ++depth;
+    return true;
+}
+
+bool GraphJsonReader::end_array() {
+    --depth;
+    if (section == EDGES && depth == 2) {
+        if (pairLen != 2) invalid("arista mal formada");
+        batch.emplace_back(pair[0], pair[1]);
+        if (batch.size() >= BATCH) flush();
+    }
+    return true;
+}
+
+bool GraphJsonReader::key(string_t& val) {
+    if (depth == 1) {
+        section = val == "users" ? USERS : val == "edges" ? EDGES : NONE;
+    } else if (section == USERS && depth == 3) {
+        if      (val == "id")         field = F_ID;
+        else if (val == "name")       field = F_NAME;
+        else if (val == "age")        field = F_AGE;
+        else if (val == "city")       field = F_CITY;
+        else if (val == "tags")       field = F_TAGS;
+        else if (val == "email")      field = F_EMAIL;
+        else if (val == "password")   field = F_PASSWORD;
+        else if (val == "profilePic") field = F_PIC;
+        else                          field = F_OTHER;
+    }
+    return true;
+}
+
+bool GraphJsonReader::parse_error(std::size_t, const std::string&,
+                                  const nlohmann::detail::exception& ex) {
+    throw std::runtime_error(ex.what());
+}
@@ -45,6 +45,15 @@ void LinkedList::insert(int key) {
     }
 }
 
+/**
+ * @brief Inserts a new key at the beginning of the list without a duplicate check.
+ * @param key The key value to insert.
+ */
+void LinkedList::insertUnique(int key) {
+    head = new Node(key, head);
+    ++len;
+}
+
 /**
  * @brief Removes the first occurrence of the specified key from the list.
  * @param key The key value to remove.
@@ -217,7 +217,7 @@ int main(int argc, char** argv) {
             tagsLabel->setText(tagList.join(";"));
 
             // Update followers display
-            auto followerIds = g.getFollowers(currentUser);
+            IdSpan followerIds = g.followersOf(currentUser);
             followersCountLabel->setText(QString::number(followerIds.size()));
             followersList->clear();
             for (auto fid : followerIds) {
@@ -231,7 +231,7 @@ int main(int argc, char** argv) {
             }
 
             // Update following display
-            auto followingIds = g.getFollowing(currentUser);
+            IdSpan followingIds = g.followingOf(currentUser);
             followingCountLabel->setText(QString::number(followingIds.size()));
             followingList->clear();
             for (auto fid : followingIds) {
@@ -266,11 +266,35 @@ int main(int argc, char** argv) {
         double avgDeg = g.averageDegree();
         int diam      = g.approximateDiameter();
         double cc     = g.averageClusteringCoefficient();
+        int comps     = g.componentCount();
         QMessageBox::information(&window, "Métricas Globales",
-            QString("Grado promedio: %1\nDiámetro aprox.: %2\nClustering medio: %3")
+            QString("Grado promedio: %1\nDiámetro aprox.: %2\nClustering medio: %3\nComponentes: %4")
                 .arg(avgDeg)
                 .arg(diam)
-                .arg(cc));
+                .arg(cc)
+                .arg(comps));
+    });
+
+    QAction* pathAction = optionsMenu->addAction("Cómo nos conectamos");
+    QObject::connect(pathAction, &QAction::triggered, [&]() {
+        bool ok;
+        QString target = QInputDialog::getText(&window, "Conexión", "ID del usuario:",
+                                               QLineEdit::Normal, "", &ok);
+        if (!ok || target.trimmed().isEmpty()) return;
+        uint64_t other = target.trimmed().toULongLong(&ok);
+        if (!ok) return;
+        std::vector<uint64_t> route = g.shortestPathRoute(currentUser, other);
+        if (route.empty()) {
+            QMessageBox::information(&window, "Conexión", "No están conectados.");
+            return;
+        }
+        QStringList names;
+        for (uint64_t id : route) {
+            User* u = g.getUser(id);
+            names << (u ? QString::fromStdString(u->name) : QString("ID %1").arg(id));
+        }
+        QMessageBox::information(&window, "Conexión",
+            QString("%1\n(%2 saltos)").arg(names.join(" → ")).arg(route.size() - 1));
     });
 
     // Account (Logout)
@@ -281,9 +305,9 @@ int main(int argc, char** argv) {
     });
 
     // Lambda to refresh the suggestion list for given parameters
-    auto refresh = [&](int user, int k, int radius){
+    auto refresh = [&](uint64_t user, int k, int radius){
         list->clear();
-        for (int v : s.suggest(user, k, radius)) {
+        for (uint64_t v : s.suggest(user, k, radius)) {
             User* u = g.getUser(v);
             if (u) {
                 list->addItem(QString("%1 (%2) — %3 años, %4")
@@ -440,19 +464,17 @@ int main(int argc, char** argv) {
             // Create and add user
             uint64_t newId = g.nextUserId();
             QString picPath = dlg.profilePic();
-            User* newUser = new User(newId, uname, age, city, tags,
-                                     email, pwd, picPath.toStdString());
-            g.addUser(*newUser);
+            User newUser(newId, uname, age, city, tags,
+                         email, pwd, picPath.toStdString());
+            g.addUser(newUser);
             // Persist updated graph to JSON
             {
-                // Serialize graph to JSON
-                nlohmann::json j = g.toJson();
-                // Write to file
+                // Stream graph to JSON file
                 std::ofstream ofs("../data/mi_red.json");
                 if (!ofs) {
                     QMessageBox::warning(&window, "Guardar JSON", "No se pudo abrir el archivo mi_red.json para escritura.");
                 } else {
-                    ofs << j.dump(2);
+                    g.writeJson(ofs);
                 }
             }
             QMessageBox::information(&window, "Registro", "Usuario registrado con éxito.");
@@ -0,0 +1,43 @@
+/**
+ * @file mapped_file.cpp
+ * @brief Implements MappedFile with POSIX open/fstat/mmap.
+ */
+#include "../include/mapped_file.h"
+#include <fcntl.h>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @brief Maps a file into memory read-only.
+ * @param path Path of the file to map.
+ * @throws std::runtime_error if the file cannot be opened or mapped.
+ */
+MappedFile::MappedFile(const std::string& path) : ptr(nullptr), len(0) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) throw std::runtime_error("No se pudo abrir: " + path);
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+        ::close(fd);
+        throw std::runtime_error("No se pudo leer tamaño de: " + path);
+    }
+    len = static_cast<std::size_t>(st.st_size);
+    if (len > 0) {
+        void* p = ::mmap(nullptr, len, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p == MAP_FAILED) {
+            ::close(fd);
+            throw std::runtime_error("No se pudo mapear: " + path);
+        }
+        ::madvise(p, len, MADV_SEQUENTIAL);
+        ptr = static_cast<const char*>(p);
+    }
+    ::close(fd);                        // el mapeo sigue válido sin el descriptor
+}
+
+/**
+ * @brief Unmaps the file.
+ */
+MappedFile::~MappedFile() {
+    if (ptr) ::munmap(const_cast<char*>(ptr), len);
+}
@@ -0,0 +1,103 @@
+/**
+ * @file multi_bfs.cpp
+ * @brief Implements the bit-parallel multi-source BFS and the queries built on it.
+ */
+#include "../include/multi_bfs.h"
+#include "../include/csr_graph.h"
+#include "../include/parallel.h"
+#include <algorithm>
+
+/**
+ * @brief Creates an engine bound to a snapshot.
+ * @param g Snapshot to traverse.
+ */
+MultiSourceBfs::MultiSourceBfs(const CsrGraph& g) : g(g) {}
+
+/**
+ * @brief Runs one bit-parallel BFS from up to LANES sources.
+ * @param sources Source indices (lane i = sources[i]).
+ * @param count Number of sources (≤ LANES).
+ * @param onLevel Called once per level with the bits first reached at that depth.
+ */
+void MultiSourceBfs::sweep(const uint32_t* sources, std::size_t count,
+                           const std::function<void(uint32_t, const std::vector<uint64_t>&)>& onLevel) {
+    uint32_t n = g.numVertices();
+    uint64_t all = count >= 64 ? ~0ULL : (1ULL << count) - 1;
+    seen.assign(n, 0);
+    frontier.assign(n, 0);
+    next.resize(n);
+    for (std::size_t i = 0; i < count; ++i) {
+        seen[sources[i]] |= 1ULL << i;
+        frontier[sources[i]] |= 1ULL << i;
+    }
+    onLevel(0, frontier);
+
+    unsigned threads = workerCount();
+    std::vector<char> advanced(threads);
+    for (uint32_t depth = 1; ; ++depth) {
+        // Cada vértice junta las fronteras de sus vecinos y se queda con lo no visto
+        std::fill(advanced.begin(), advanced.end(), 0);
+        parallelFor(n, [&](std::size_t b, std::size_t e, unsigned t) {
+            char any = 0;
+            for (std::size_t w = b; w < e; ++w) {
+                uint64_t s = seen[w];
+                if (s == all) { next[w] = 0; continue; }     // ya alcanzado por todos
+                uint64_t acc = 0;
+                for (uint32_t v : g.neighbors(static_cast<uint32_t>(w))) acc |= frontier[v];
+                acc &= ~s;
+                next[w] = acc;
+                any |= acc != 0;
+            }
+            advanced[t] = any;
+        }, threads);
+        if (std::find(advanced.begin(), advanced.end(), 1) == advanced.end()) break;
+
+        parallelFor(n, [&](std::size_t b, std::size_t e, unsigned) {
+            for (std::size_t w = b; w < e; ++w) seen[w] |= next[w];
+        }, threads);
+        onLevel(depth, next);
+        frontier.swap(next);
+    }
+}
+
+/**
+ * @brief Computes the eccentricity of each source in batches of LANES.
+ * @param sources Dense source indices.
+ * @return Largest finite distance from each source.
+ */
+std::vector<uint32_t> MultiSourceBfs::eccentricities(const std::vector<uint32_t>& sources) {
+    std::vector<uint32_t> ecc(sources.size(), 0);
+    for (std::size_t base = 0; base < sources.size(); base += LANES) {
+        std::size_t count = std::min(LANES, sources.size() - base);
+        sweep(sources.data() + base, count, [&](uint32_t depth, const std::vector<uint64_t>& fresh) {
+            if (depth == 0) return;
+            // Fuentes que todavía avanzan en este nivel
+            uint64_t lanes = 0;
+            for (uint64_t m : fresh) lanes |= m;
+            for (; lanes; lanes &= lanes - 1) ecc[base + __builtin_ctzll(lanes)] = depth;
+        });
+    }
+    return ecc;
+}
+
+/**
+ * @brief Computes source × target distances in batches of LANES sources.
+ * @param sources Dense source indices.
+ * @param targets Dense target indices.
+ * @return Row-major distance matrix (-1 = unreachable).
+ */
+std::vector<int> MultiSourceBfs::distances(const std::vector<uint32_t>& sources,
+                                           const std::vector<uint32_t>& targets) {
+    std::size_t nt = targets.size();
+    std::vector<int> dist(sources.size() * nt, -1);
+    for (std::size_t base = 0; base < sources.size(); base += LANES) {
+        std::size_t count = std::min(LANES, sources.size() - base);
+        sweep(sources.data() + base, count, [&](uint32_t depth, const std::vector<uint64_t>& fresh) {
+            for (std::size_t j = 0; j < nt; ++j) {
+                for (uint64_t m = fresh[targets[j]]; m; m &= m - 1)
+                    dist[(base + __builtin_ctzll(m)) * nt + j] = static_cast<int>(depth);
+            }
+        });
+    }
+    return dist;
+}
@@ -0,0 +1,134 @@
+/**
+ * @file neighbor_list.cpp
+ * @brief Implements the sorted small-vector adjacency list.
+ */
+#include "../include/neighbor_list.h"
+#include <algorithm>
+#include <cstring>
+
+/**
+ * @brief Frees the heap array, if any.
+ */
+NeighborList::~NeighborList() {
+    if (!isInline()) delete[] heap;
+}
+
+/**
+ * @brief Copies another list (same capacity class).
+ * @param other List to copy.
+ */
+NeighborList::NeighborList(const NeighborList& other) : count(other.count), cap(INLINE) {
+    if (other.count > INLINE) {
+        cap = other.count;
+        heap = new uint32_t[cap];
+    }
+    std::memcpy(buffer(), other.data(), count * sizeof(uint32_t));
+}
+
+/**
+ * @brief Takes the other list's storage, leaving it empty.
+ * @param other List to move from.
+ */
+NeighborList::NeighborList(NeighborList&& other) noexcept : count(other.count), cap(other.cap) {
+    if (other.isInline()) {
+        std::memcpy(inl, other.inl, sizeof(inl));
+    } else {
+        heap = other.heap;
+        other.cap = INLINE;
+    }
+    other.count = 0;
+}
+
+/**
+ * @brief Copy-and-swap assignment.
+ * @param other List to take the contents of.
+ * @return This list.
+ */
+NeighborList& NeighborList::operator=(NeighborList other) noexcept {
+    // Intercambio por bytes: la unión no tiene miembro activo fijo
+    unsigned char tmp[sizeof(NeighborList)];
+    std::memcpy(tmp, static_cast<void*>(this), sizeof(NeighborList));
+    std::memcpy(static_cast<void*>(this), static_cast<void*>(&other), sizeof(NeighborList));
+    std::memcpy(static_cast<void*>(&other), tmp, sizeof(NeighborList));
+    return *this;
+}
+
+/**
+ * @brief Ensures room for need neighbors, doubling the capacity.
+ * @param need Required capacity.
+ */
+void NeighborList::grow(uint32_t need) {
+    if (need <= cap) return;
+    uint32_t newCap = std::max(need, cap * 2);
+    uint32_t* fresh = new uint32_t[newCap];
+    std::memcpy(fresh, data(), count * sizeof(uint32_t));
+    if (!isInline()) delete[] heap;
+    heap = fresh;
+    cap = newCap;
+}
+
+/**
+ * @brief Checks membership with a binary search.
+ * @param v Dense index.
+ * @return true if present.
+ */
+bool NeighborList::contains(uint32_t v) const {
+    return std::binary_search(begin(), end(), v);
+}
+
+/**
+ * @brief Inserts at the sorted position (shifts the tail by one).
+ * @param v Dense index.
+ * @return true if inserted.
+ */
+bool NeighborList::insert(uint32_t v) {
+    std::size_t pos = static_cast<std::size_t>(std::lower_bound(begin(), end(), v) - begin());
+    if (pos < count && data()[pos] == v) return false;
+    grow(count + 1);
+    uint32_t* b = buffer();
+    std::memmove(b + pos + 1, b + pos, (count - pos) * sizeof(uint32_t));
+    b[pos] = v;
+    ++count;
+    return true;
+}
+
+/**
+ * @brief Removes a neighbor, shifting the tail back.
+ * @param v Dense index.
+ * @return true if it was present.
+ */
+bool NeighborList::erase(uint32_t v) {
+    std::size_t pos = static_cast<std::size_t>(std::lower_bound(begin(), end(), v) - begin());
+    if (pos == count || data()[pos] != v) return false;
+    uint32_t* b = buffer();
+    std::memmove(b + pos, b + pos + 1, (count - pos - 1) * sizeof(uint32_t));
+    --count;
+    return true;
+}
+
+/**
+ * @brief Merges sorted new neighbors from the back, in place.
+ * @param vals Sorted indices not yet in the list.
+ * @param k Number of indices.
+ */
+void NeighborList::mergeSorted(const uint32_t* vals, std::size_t k) {
+    if (k == 0) return;
+    grow(count + static_cast<uint32_t>(k));
+    uint32_t* b = buffer();
+    // De atrás hacia adelante: cada hueco se llena con el mayor pendiente
+    std::size_t i = count, j = k, out = count + k;
+    while (j > 0) {
+        if (i > 0 && b[i - 1] > vals[j - 1]) b[--out] = b[--i];
+        else b[--out] = vals[--j];
+    }
+    count += static_cast<uint32_t>(k);
+}
+
+/**
+ * @brief Empties the list and returns to inline storage.
+ */
+void NeighborList::clear() {
+    if (!isInline()) delete[] heap;
+    cap = INLINE;
+    count = 0;
+}
@@ -0,0 +1,74 @@
+/**
+ * @file parallel.cpp
+ * @brief Implements the std::thread helpers: chunked parallel loops and parallel sort.
+ */
+#include "../include/parallel.h"
+#include <algorithm>
+#include <thread>
+
+/**
+ * @brief Returns the number of worker threads to use.
+ * @return Hardware concurrency, at least 1.
+ */
+unsigned workerCount() {
+    unsigned t = std::thread::hardware_concurrency();
+    return t ? t : 1;
+}
+
+/**
+ * @brief Runs body over contiguous chunks of [0, n), one thread per chunk.
+ * @param n Range size.
+ * @param body Callback receiving (begin, end, chunk index).
+ * @param threads Number of chunks (0 = workerCount()).
+ */
+void parallelFor(std::size_t n,
+                 const std::function<void(std::size_t, std::size_t, unsigned)>& body,
+                 unsigned threads) {
+    if (threads == 0) threads = workerCount();
+    if (n < threads) threads = static_cast<unsigned>(n);   // a lo sumo un elemento por hilo
+    if (threads <= 1) {
+        body(0, n, 0);
+        return;
+    }
+    std::size_t chunk = (n + threads - 1) / threads;
+    threads = static_cast<unsigned>((n + chunk - 1) / chunk);   // sin trozos vacíos al final
+    std::vector<std::thread> pool;
+    pool.reserve(threads - 1);
+    for (unsigned t = 1; t < threads; ++t) {
+        std::size_t b = std::min(n, t * chunk);
+        std::size_t e = std::min(n, b + chunk);
+        pool.emplace_back(body, b, e, t);
+    }
+    body(0, std::min(n, chunk), 0);
+    for (std::thread& th : pool) th.join();
+}
+
+/**
+ * @brief Sorts chunks in parallel, then merges neighbouring runs in parallel rounds.
+ * @param v Vector to sort in place.
+ */
+void parallelSort(std::vector<uint64_t>& v) {
+    unsigned threads = workerCount();
+    if (threads <= 1 || v.size() < (1u << 16)) {
+        std::sort(v.begin(), v.end());
+        return;
+    }
+    std::size_t n = v.size();
+    std::size_t chunk = (n + threads - 1) / threads;
+    parallelFor(n, [&](std::size_t b, std::size_t e, unsigned) {
+        std::sort(v.begin() + b, v.begin() + e);
+    }, threads);
+
+    // Fusiones por rondas: runs de tamaño chunk, 2·chunk, ...
+    for (std::size_t width = chunk; width < n; width *= 2) {
+        std::size_t pairs = (n + 2 * width - 1) / (2 * width);
+        parallelFor(pairs, [&](std::size_t b, std::size_t e, unsigned) {
+            for (std::size_t p = b; p < e; ++p) {
+                std::size_t lo = p * 2 * width;
+                std::size_t mid = std::min(n, lo + width);
+                std::size_t hi = std::min(n, lo + 2 * width);
+                std::inplace_merge(v.begin() + lo, v.begin() + mid, v.begin() + hi);
+            }
+        }, static_cast<unsigned>(std::min<std::size_t>(pairs, threads)));
+    }
+}
@@ -0,0 +1,121 @@
+/**
+ * @file path_finder.cpp
+ * @brief Implements the bidirectional BFS used for shortest paths.
+ */
+#include "../include/path_finder.h"
+#include "../include/csr_graph.h"
+#include <algorithm>
+
+/**
+ * @brief Sizes the scratch buffers for n vertices and starts a new epoch.
+ * @param n Number of vertices in the snapshot.
+ */
+void PathFinder::prepare(uint32_t n) {
+    for (int side = 0; side < 2; ++side) {
+        if (stamp[side].size() < n) {
+            stamp[side].resize(n, 0);
+            dist[side].resize(n);
+            parent[side].resize(n);
+        }
+    }
+    if (++epoch == 0) {
+        // Desborde de la época: limpiar una vez y reiniciar
+        for (auto& s : stamp) std::fill(s.begin(), s.end(), 0);
+        epoch = 1;
+    }
+    visited = 0;
+}
+
+/**
+ * @brief Runs the bidirectional search.
+ * @param g Graph snapshot.
+ * @param src Source dense index.
+ * @param dst Destination dense index.
+ * @param hops Receives the distance when a meeting vertex is found.
+ * @return Vertex where both searches met, or NONE if unreachable.
+ */
+uint32_t PathFinder::search(const CsrGraph& g, uint32_t src, uint32_t dst, int& hops) {
+    prepare(g.numVertices());
+    const uint32_t ends[2] = {src, dst};
+    for (int side = 0; side < 2; ++side) {
+        uint32_t v = ends[side];
+        stamp[side][v] = epoch;
+        dist[side][v] = 0;
+        parent[side][v] = v;
+        front[side].assign(1, v);
+    }
+    visited = 2;
+    if (src == dst) { hops = 0; return src; }
+
+    while (!front[0].empty() && !front[1].empty()) {
+        // Expandir el lado cuya frontera tiene menos aristas salientes
+        std::size_t work[2] = {0, 0};
+        for (int side = 0; side < 2; ++side)
+            for (uint32_t u : front[side]) work[side] += g.degree(u);
+        int x = work[0] <= work[1] ? 0 : 1;
+        int y = 1 - x;
+
+        std::vector<uint32_t>& sx = stamp[x];
+        const std::vector<uint32_t>& sy = stamp[y];
+        next.clear();
+        for (uint32_t u : front[x]) {
+            uint32_t du = dist[x][u] + 1;
+            for (uint32_t v : g.neighbors(u)) {
+                if (sx[v] == epoch) continue;
+                sx[v] = epoch;
+                dist[x][v] = du;
+                parent[x][v] = u;
+                ++visited;
+                if (sy[v] == epoch) {
+                    // Primer contacto: los conjuntos eran disjuntos hasta este nivel,
+                    // así que esta ruta ya es mínima
+                    hops = static_cast<int>(du + dist[y][v]);
+                    return v;
+                }
+                next.push_back(v);
+            }
+        }
+        front[x].swap(next);
+    }
+    return NONE;
+}
+
+/**
+ * @brief Computes the hop distance between two vertices.
+ * @param g Graph snapshot.
+ * @param src Source dense index.
+ * @param dst Destination dense index.
+ * @return Number of hops, or -1 if unreachable.
+ */
+int PathFinder::distance(const CsrGraph& g, uint32_t src, uint32_t dst) {
+    int hops = -1;
+    search(g, src, dst, hops);
+    return hops;
+}
+
+/**
+ * @brief Computes one shortest route between two vertices.
+ * @param g Graph snapshot.
+ * @param src Source dense index.
+ * @param dst Destination dense index.
+ * @return Dense indices from src to dst inclusive, or empty if unreachable.
+ */
+std::vector<uint32_t> PathFinder::path(const CsrGraph& g, uint32_t src, uint32_t dst) {
+    int hops = -1;
+    uint32_t meet = search(g, src, dst, hops);
+    std::vector<uint32_t> route;
+    if (meet == NONE) return route;
+    route.reserve(static_cast<std::size_t>(hops) + 1);
+    // Mitad del origen (meet → src), luego invertida
+    for (uint32_t v = meet; ; v = parent[0][v]) {
+        route.push_back(v);
+        if (v == src) break;
+    }
+    std::reverse(route.begin(), route.end());
+    // Mitad del destino (meet → dst)
+    for (uint32_t v = meet; v != dst; ) {
+        v = parent[1][v];
+        route.push_back(v);
+    }
+    return route;
+}
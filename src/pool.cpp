@@ -0,0 +1,60 @@
+/**
+ * @file pool.cpp
+ * @brief Implements the Arena bump allocator (ObjectPool is header-only).
+ */
+#include "../include/pool.h"
+#include <algorithm>
+
+/**
+ * @brief Starts a new block twice the previous one (up to the cap) and large enough for need bytes.
+ * @param need Bytes (including alignment slack) that must fit.
+ */
+void Arena::newBlock(std::size_t need) {
+    std::size_t size = std::max(std::min(std::max(firstSize, lastSize * 2), maxSize), need);
+    blocks.emplace_back(new unsigned char[size]);
+    lastSize = size;
+    if (size > largestSize) {                      // un pedido grande puede superar al siguiente bloque
+        largest = blocks.size() - 1;
+        largestSize = size;
+    }
+    offset = 0;
+    st.bytesReserved += size;
+    ++st.chunks;
+}
+
+/**
+ * @brief Bumps the offset inside the current block (new block when it does not fit).
+ * @param bytes Size in bytes.
+ * @param align Alignment (power of two).
+ * @return Aligned pointer.
+ */
+void* Arena::allocate(std::size_t bytes, std::size_t align) {
+    std::size_t pos = (offset + align - 1) & ~(align - 1);
+    if (blocks.empty() || pos + bytes > lastSize) {
+        newBlock(bytes + align);
+        pos = 0;                                   // new[] ya está alineado a max_align_t
+    }
+    offset = pos + bytes;
+    ++st.allocations;
+    ++st.live;
+    st.bytesInUse += bytes;
+    return blocks.back().get() + pos;
+}
+
+/**
+ * @brief Drops all objects; frees every block but the largest one, which becomes the current block.
+ */
+void Arena::reset() {
+    if (blocks.size() > 1) {
+        std::unique_ptr<unsigned char[]> keep = std::move(blocks[largest]);
+        blocks.clear();
+        blocks.push_back(std::move(keep));
+        largest = 0;
+        lastSize = largestSize;
+        st.bytesReserved = largestSize;
+        st.chunks = 1;
+    }
+    offset = 0;
+    st.live = 0;
+    st.bytesInUse = 0;
+}
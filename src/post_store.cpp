@@ -0,0 +1,118 @@
+/**
+ * @file post_store.cpp
+ * @brief Implements PostStore: ID assignment, the per-author index, arena text and comment chains.
+ */
+#include "../include/post_store.h"
+#include <cstring>
+
+/**
+ * @brief Copies text into an arena.
+ * @param arena Text arena.
+ * @param text Bytes to copy.
+ * @return View of the copy (empty text takes no space).
+ */
+std::string_view PostStore::copyText(Arena& arena, std::string_view text) {
+    if (text.empty()) return {};
+    char* p = static_cast<char*>(arena.allocate(text.size(), 1));
+    std::memcpy(p, text.data(), text.size());
+    return {p, text.size()};
+}
+
+/**
+ * @brief Appends a post, assigning the next ID and indexing it under its author.
+ * @param author ID of the author.
+ * @param text Content (copied into the text arena).
+ * @param timestamp Creation time.
+ * @return The new post's ID.
+ */
+uint64_t PostStore::add(uint64_t author, std::string_view text, std::time_t timestamp) {
+    Post p;
+    p.id = slots.size() + 1;
+    p.userId = author;
+    p.text = copyText(postText, text);
+    p.timestamp = timestamp;
+    slots.push_back(p);
+    chains.emplace_back();
+    authorIndex[author].push_back(p.id);
+    return p.id;
+}
+
+/**
+ * @brief Returns an author's post IDs in creation order.
+ * @param author ID of the author.
+ * @return ID list; a shared empty list if the author has no posts.
+ */
+const std::vector<uint64_t>& PostStore::byAuthor(uint64_t author) const {
+    static const std::vector<uint64_t> none;
+    auto it = authorIndex.find(author);
+    return it == authorIndex.end() ? none : it->second;
+}
+
+/**
+ * @brief Appends a comment row and links it at the end of its post's chain.
+ * @param postId Post ID.
+ * @param text Content (copied into the comment arena).
+ * @param timestamp Creation time.
+ * @return false if the post does not exist.
+ */
+bool PostStore::addComment(uint64_t postId, std::string_view text, std::time_t timestamp) {
+    Post* p = get(postId);
+    if (!p) return false;
+    uint32_t row = static_cast<uint32_t>(commentRows.size());
+    CommentRow r;
+    r.c.postId = postId;
+    r.c.text = copyText(commentText, text);
+    r.c.timestamp = timestamp;
+    commentRows.push_back(r);
+    Chain& ch = chains[postId - 1];
+    if (ch.last == NO_COMMENT) ch.first = row;
+    else commentRows[ch.last].next = row;
+    ch.last = row;
+    ++p->comments;
+    return true;
+}
+
+/**
+ * @brief Walks a post's comment chain from the cursor.
+ *
+ * The cursor is the row of the next comment plus one, so a page costs
+ * O(limit) whatever the number of comments before it.
+ * @param postId Post ID.
+ * @param limit Maximum number of comments in the page.
+ * @param cursor 0 for the first page, otherwise the previous page's next.
+ * @return The page, oldest first.
+ */
+CommentPage PostStore::comments(uint64_t postId, std::size_t limit, uint64_t cursor) const {
+    CommentPage page;
+    if (!get(postId)) return page;
+    uint32_t row = chains[postId - 1].first;
+    if (cursor) {
+        // Un cursor ajeno al post no avanza por otra cadena
+        if (cursor > commentRows.size() || commentRows[cursor - 1].c.postId != postId) return page;
+        row = static_cast<uint32_t>(cursor - 1);
+    }
+    for (; row != NO_COMMENT && page.comments.size() < limit; row = commentRows[row].next)
+        page.comments.push_back(commentRows[row].c);
+    page.more = row != NO_COMMENT;
+    page.next = page.more ? static_cast<uint64_t>(row) + 1 : 0;
+    return page;
+}
+
+/**
+ * @brief Adds up the bytes held by records, arenas and the author index.
+ * @return Memory report.
+ */
+PostStoreStats PostStore::stats() const {
+    PostStoreStats s;
+    s.posts = slots.size();
+    s.comments = commentRows.size();
+    s.textBytes = postText.stats().bytesInUse + commentText.stats().bytesInUse;
+    s.arenaBytes = postText.stats().bytesReserved + commentText.stats().bytesReserved;
+    s.recordBytes = slots.capacity() * sizeof(Post) + commentRows.capacity() * sizeof(CommentRow)
+                  + chains.capacity() * sizeof(Chain);
+    // Índice por autor: nodo de la tabla (par + enlace + hash) más la lista de IDs
+    s.indexBytes = authorIndex.bucket_count() * sizeof(void*);
+    for (const auto& kv : authorIndex)
+        s.indexBytes += sizeof(kv) + 2 * sizeof(void*) + kv.second.capacity() * sizeof(uint64_t);
+    return s;
+}
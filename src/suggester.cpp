@@ -3,8 +3,8 @@
  * @brief Implements the Suggester class methods for generating friend suggestions based on mutual friends, tags, and network distance.
  */
 #include "../include/suggester.h"
+#include "../include/bfs_engine.h"
 #include <unordered_set>
-#include <unordered_map>
 #include <algorithm>
 
 // ------------------------------------------------------------------
@@ -14,62 +14,86 @@
  * @brief Counts shared interest tags between two users.
  * @param a ID of the first user.
  * @param b ID of the second user.
- * @return Number of tags both users share.
+ * @return Number of distinct tags both users share.
  */
-int Suggester::commonTags(int a, int b) const {
+int Suggester::commonTags(uint64_t a, uint64_t b) const {
     User* ua = g->getUser(a);
-    User* ub = g->getUser(b);
-    if (!ua || !ub) return 0;
+    if (!ua) return 0;
     std::unordered_set<std::string> setA(ua->tags.begin(), ua->tags.end());
+    return commonTags(setA, b);
+}
+
+/**
+ * @brief Counts how many of a user's distinct tags appear in a prebuilt tag set.
+ * @param tagsA Tags of the first user.
+ * @param b ID of the second user.
+ * @return Number of distinct shared tags (never more than tagsA.size()).
+ */
+int Suggester::commonTags(const std::unordered_set<std::string>& tagsA, uint64_t b) const {
+    User* ub = g->getUser(b);
+    if (!ub || tagsA.empty()) return 0;
+    const std::vector<std::string>& tb = ub->tags;
     int c = 0;
-    for (const std::string& t : ub->tags)
-        if (setA.count(t)) ++c;
+    for (std::size_t i = 0; i < tb.size(); ++i)
+        if (tagsA.count(tb[i]) && std::find(tb.begin(), tb.begin() + i, tb[i]) == tb.begin() + i) ++c;
     return c;
 }
 
 /**
  * @brief Generates up to k friend suggestions for a user within a specified radius.
+ *
+ * Runs one BfsEngine search over the graph's CSR snapshot from u, limited to
+ * radius hops. Mutual friends of each distance-2 vertex are then counted by
+ * scanning the neighbors of the direct friends (level 1 of the search), so
+ * candidates are scored without any further traversal. Scores stream into a
+ * fixed-capacity TopK, so only the k best candidates are ever kept.
  * @param u The user ID for whom to generate suggestions.
  * @param k Maximum number of suggestions to return.
  * @param radius Maximum network distance (hops) to consider.
  * @return A vector of suggested user IDs ordered by descending composite score.
  */
-std::vector<int> Suggester::suggest(int u, int k, int radius) const {
-    LinkedList* neigh = g->neighbors(u);
-    if (!neigh) return {};
-
-    // amigos directos + yo
-    std::unordered_set<int> already;
-    already.reserve(neigh->size() * 2 + 1);
-    already.insert(u);
-    for (Node* p = neigh->begin(); p; p = p->next) already.insert(p->key);
+std::vector<uint64_t> Suggester::suggest(uint64_t u, int k, int radius) const {
+    auto view = g->snapshot();
+    const IdMap& ids = g->idMap();
+    uint32_t src = ids.find(u);
+    if (k <= 0 || src == IdMap::NONE || src >= view->numVertices()) return {};
 
-    // Acumular #mutuos por candidato
-    std::unordered_map<int,int> mutualCnt;
+    // Búferes por hilo e índice denso del snapshot (se limpian tras cada consulta)
+    thread_local BfsEngine bfs;
+    thread_local std::vector<int> mutualBuf;
+    if (mutualBuf.size() != view->numVertices()) mutualBuf.assign(view->numVertices(), 0);
+    uint32_t depth = bfs.run(*view, src, static_cast<uint32_t>(std::max(radius, 0)));
 
-    for (Node* p = neigh->begin(); p; p = p->next) {
-        int friendId = p->key;
-        LinkedList* neigh2 = g->neighbors(friendId);
-        if (!neigh2) continue;
-        for (Node* q = neigh2->begin(); q; q = q->next) {
-            int v = q->key;
-            if (already.count(v)) continue;
+    // x es amigo directo e y está a distancia 2: x es un amigo mutuo
+    if (depth >= 2) {
+        std::pair<const uint32_t*, const uint32_t*> friends = bfs.level(1);
+        for (const uint32_t* x = friends.first; x != friends.second; ++x)
+            for (uint32_t y : view->neighbors(*x))
+                if (bfs.distance(y) == 2) ++mutualBuf[y];
+    }
 
-            int d = g->shortestPath(u, v);
-            if (d == -1 || d > radius) continue;
+    // Etiquetas de u una sola vez; cota del aporte de etiquetas para descartar sin consultarlas
+    const User* pu = g->getUser(u);
+    std::unordered_set<std::string> tagsU;
+    if (pu && wTags != 0) tagsU.insert(pu->tags.begin(), pu->tags.end());
+    int tagBound = wTags > 0 ? wTags * static_cast<int>(tagsU.size()) : 0;
 
-            ++mutualCnt[v];      // acumula mutuo
+    // Selección de los k mejores por puntaje compuesto; los empates se resuelven
+    // por ID de usuario (mayor primero, como el AVLTree original), no por índice denso
+    // Nunca hay más candidatos que vértices: k se acota antes de reservar
+    TopK<int, uint64_t> best(std::min(static_cast<std::size_t>(k), static_cast<std::size_t>(view->numVertices())));
+    for (uint32_t v : bfs.order()) {
+        int d = bfs.distance(v);
+        if (d >= 2) {                       // excluye a u y a sus amigos directos
+            int base = wMutuos * mutualBuf[v] - wDist * d;
+            // Sin opción de entrar aunque comparta todas las etiquetas (p. ej. d >= 3 sin mutuos)
+            if (!(best.full() && base + tagBound < best.worst().score)) {
+                uint64_t id = ids.external(v);
+                best.offer(base + wTags * commonTags(tagsU, id), id);
+            }
         }
+        mutualBuf[v] = 0;
     }
 
-    // Construir AVL con puntaje compuesto
-    AVLTree tree;
-    for (auto& [cand, mutCnt] : mutualCnt) {
-        int d = g->shortestPath(u, cand);
-        int tagC = commonTags(u, cand);
-        int score = wMutuos * mutCnt + wTags * tagC - wDist * d;
-        tree.insert(cand, score);
-    }
-
-    return tree.topK(k);
+    return best.keys();
 }
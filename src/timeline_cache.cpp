@@ -0,0 +1,97 @@
+/**
+ * @file timeline_cache.cpp
+ * @brief Implements the TimelineCache rings.
+ */
+#include "../include/timeline_cache.h"
+
+/**
+ * @brief Returns a reader's ring, growing the table if needed.
+ * @param reader Dense index of the reader.
+ * @return The ring (stale if new).
+ */
+TimelineCache::Ring& TimelineCache::ring(uint32_t reader) {
+    if (reader >= rings.size()) rings.resize(static_cast<std::size_t>(reader) + 1);
+    return rings[reader];
+}
+
+/**
+ * @brief Appends a post ID, overwriting the oldest one when the ring is full.
+ * @param reader Dense index of the reader.
+ * @param postId Post ID.
+ */
+void TimelineCache::push(uint32_t reader, uint64_t postId) {
+    if (!fresh(reader)) return;
+    Ring& r = rings[reader];
+    uint32_t cap = static_cast<uint32_t>(cfg.capacity);
+    if (r.count && r.ids[(r.start + r.count - 1) % cap] == postId) return;   // amigo y seguidor a la vez
+    if (r.count < cap) {
+        r.ids[(r.start + r.count) % cap] = postId;
+        ++r.count;
+    } else {
+        r.ids[r.start] = postId;
+        r.start = (r.start + 1) % cap;
+        r.dropped = true;
+    }
+    ++st.pushes;
+}
+
+/**
+ * @brief Refills a ring from a newest-first list and marks it fresh.
+ * @param reader Dense index of the reader.
+ * @param newestFirst Post IDs, newest first.
+ * @param complete false if older posts exist beyond the list.
+ */
+void TimelineCache::rebuild(uint32_t reader, const std::vector<uint64_t>& newestFirst, bool complete) {
+    Ring& r = ring(reader);
+    if (!r.ids && cfg.capacity) {
+        r.ids.reset(new uint64_t[cfg.capacity]);
+        st.bytes += cfg.capacity * sizeof(uint64_t);
+    }
+    std::size_t n = newestFirst.size() < cfg.capacity ? newestFirst.size() : cfg.capacity;
+    for (std::size_t i = 0; i < n; ++i) r.ids[i] = newestFirst[n - 1 - i];   // ascendente
+    r.start = 0;
+    r.count = static_cast<uint32_t>(n);
+    r.dropped = !complete || n < newestFirst.size();
+    r.stale = cfg.capacity == 0;
+    ++st.rebuilds;
+}
+
+/**
+ * @brief Marks a ring stale; its memory is kept for the next rebuild.
+ * @param reader Dense index of the reader.
+ */
+void TimelineCache::invalidate(uint32_t reader) {
+    if (reader < rings.size()) rings[reader].stale = true;
+}
+
+/**
+ * @brief Marks every ring stale.
+ */
+void TimelineCache::invalidateAll() {
+    for (Ring& r : rings) r.stale = true;
+}
+
+/**
+ * @brief Exposes the ring as ascending runs.
+ * @param reader Dense index of a fresh reader.
+ * @param out Receives up to two runs.
+ * @return Oldest ID kept if older ones were dropped, else 0.
+ */
+uint64_t TimelineCache::runs(uint32_t reader, std::vector<PostRun>& out) const {
+    const Ring& r = rings[reader];
+    if (r.count == 0) return r.dropped ? UINT64_MAX : 0;
+    std::size_t cap = cfg.capacity;
+    std::size_t first = r.start + r.count <= cap ? r.count : cap - r.start;
+    out.push_back({r.ids.get() + r.start, first});
+    if (first < r.count) out.push_back({r.ids.get(), r.count - first});
+    return r.dropped ? r.ids[r.start] : 0;
+}
+
+/**
+ * @brief Flags an author as a celebrity.
+ * @param author Dense index of the author.
+ */
+void TimelineCache::markCelebrity(uint32_t author) {
+    if (author >= celebrity.size()) celebrity.resize(static_cast<std::size_t>(author) + 1, 0);
+    celebrity[author] = 1;
+}
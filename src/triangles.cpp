@@ -0,0 +1,109 @@
+/**
+ * @file triangles.cpp
+ * @brief Implements degree-oriented parallel triangle counting.
+ */
+#include "../include/triangles.h"
+#include "../include/csr_graph.h"
+#include "../include/intersect.h"
+#include "../include/parallel.h"
+#include <atomic>
+#include <memory>
+
+namespace {
+
+/// Vértices por bloque repartido entre hilos.
+const uint32_t BLOCK = 256;
+
+/**
+ * @brief Runs body(u, thread) over [0, n) in blocks taken from a shared counter (balanceo dinámico).
+ */
+template <typename Body>
+void forEachBlock(uint32_t n, unsigned threads, Body body) {
+    std::atomic<uint32_t> next{0};
+    parallelFor(threads, [&](std::size_t, std::size_t, unsigned t) {
+        for (;;) {
+            uint32_t b = next.fetch_add(BLOCK, std::memory_order_relaxed);
+            if (b >= n) break;
+            uint32_t e = b + BLOCK < n ? b + BLOCK : n;
+            for (uint32_t u = b; u < e; ++u) body(u, t);
+        }
+    }, threads);
+}
+
+} // namespace
+
+/**
+ * @brief Counts triangles over degree-oriented out-lists and derives clustering metrics.
+ * @param g Snapshot to analyze.
+ * @return Triangle statistics.
+ */
+TriangleStats countTriangles(const CsrGraph& g) {
+    uint32_t n = g.numVertices();
+    TriangleStats st;
+    st.perVertex.assign(n, 0);
+    if (n == 0) return st;
+
+    // Orientación: u → v si (grado, índice) de u es menor que el de v
+    auto before = [&g](uint32_t u, uint32_t v) {
+        uint32_t du = g.degree(u), dv = g.degree(v);
+        return du < dv || (du == dv && u < v);
+    };
+    std::vector<uint32_t> outOff(n + 1, 0);
+    parallelFor(n, [&](std::size_t b, std::size_t e, unsigned) {
+        for (std::size_t i = b; i < e; ++i) {
+            uint32_t u = static_cast<uint32_t>(i), c = 0;
+            for (uint32_t v : g.neighbors(u)) c += before(u, v);
+            outOff[u + 1] = c;
+        }
+    });
+    for (uint32_t u = 0; u < n; ++u) outOff[u + 1] += outOff[u];
+    std::vector<uint32_t> out(outOff[n]);
+    parallelFor(n, [&](std::size_t b, std::size_t e, unsigned) {
+        for (std::size_t i = b; i < e; ++i) {
+            uint32_t u = static_cast<uint32_t>(i), pos = outOff[u];
+            for (uint32_t v : g.neighbors(u))          // el filtro conserva el orden
+                if (before(u, v)) out[pos++] = v;
+        }
+    });
+
+    // Cada triángulo u→v→w se encuentra una sola vez, desde su vértice de menor rango
+    std::unique_ptr<std::atomic<uint64_t>[]> tri(new std::atomic<uint64_t>[n]);
+    for (uint32_t v = 0; v < n; ++v) tri[v].store(0, std::memory_order_relaxed);
+    std::atomic<uint64_t> total{0};
+    unsigned threads = workerCount();
+    std::vector<std::vector<uint32_t>> common(threads);     // tercer vértice de cada triángulo, por hilo
+    forEachBlock(n, threads, [&](uint32_t u, unsigned t) {
+        const uint32_t* ub = out.data() + outOff[u];
+        std::size_t ud = outOff[u + 1] - outOff[u];
+        std::vector<uint32_t>& buf = common[t];
+        if (buf.size() < ud) buf.resize(ud);
+        uint64_t own = 0;
+        for (std::size_t k = 0; k < ud; ++k) {
+            uint32_t v = ub[k];
+            std::size_t c = intersect(ub, ud, out.data() + outOff[v], outOff[v + 1] - outOff[v], buf.data());
+            for (std::size_t i = 0; i < c; ++i) tri[buf[i]].fetch_add(1, std::memory_order_relaxed);
+            if (c) tri[v].fetch_add(c, std::memory_order_relaxed);
+            own += c;
+        }
+        if (own) {
+            tri[u].fetch_add(own, std::memory_order_relaxed);
+            total.fetch_add(own, std::memory_order_relaxed);
+        }
+    });
+    st.total = total.load();
+
+    // Coeficientes local medio y global
+    double sumC = 0.0, triples = 0.0;
+    uint32_t counted = 0;
+    for (uint32_t v = 0; v < n; ++v) {
+        st.perVertex[v] = tri[v].load(std::memory_order_relaxed);
+        uint32_t d = g.degree(v);
+        if (d < 2) continue;
+        sumC += st.local(v, d);
+        triples += d * (d - 1.0) / 2.0;
+        ++counted;
+    }
+    st.averageClustering = counted ? sumC / counted : 0.0;
+    st.transitivity = triples > 0 ? 3.0 * st.total / triples : 0.0;
+    return st;
+}
@@ -0,0 +1,125 @@
+/**
+ * @file union_find.cpp
+ * @brief Implements the sequential and parallel lock-free disjoint-set operations.
+ */
+#include "../include/union_find.h"
+#include "../include/csr_graph.h"
+#include "../include/parallel.h"
+#include <atomic>
+#include <memory>
+#include <utility>
+
+/**
+ * @brief Extends the forest with singletons up to n elements.
+ * @param n New element count.
+ */
+void UnionFind::grow(uint32_t n) {
+    uint32_t old = size();
+    if (n <= old) return;
+    parent.resize(n);
+    rnk.resize(n, 0);
+    for (uint32_t i = old; i < n; ++i) parent[i] = i;
+}
+
+/**
+ * @brief Finds the root of x with path halving.
+ * @param x Element.
+ * @return Root of x's tree.
+ */
+uint32_t UnionFind::find(uint32_t x) {
+    while (parent[x] != x) {
+        parent[x] = parent[parent[x]];   // cada nodo salta a su abuelo
+        x = parent[x];
+    }
+    return x;
+}
+
+/**
+ * @brief Walks up to the root of x without writing; indices past the forest are singletons.
+ * @param x Element.
+ * @return Root of x's tree.
+ */
+uint32_t UnionFind::root(uint32_t x) const {
+    if (x >= parent.size()) return x;
+    while (parent[x] != x) x = parent[x];
+    return x;
+}
+
+/**
+ * @brief Unites the sets of a and b by rank.
+ * @param a First element.
+ * @param b Second element.
+ * @return true if a merge happened.
+ */
+bool UnionFind::unite(uint32_t a, uint32_t b) {
+    a = find(a);
+    b = find(b);
+    if (a == b) return false;
+    if (rnk[a] < rnk[b]) std::swap(a, b);
+    parent[b] = a;
+    if (rnk[a] == rnk[b]) ++rnk[a];
+    ++merged;
+    return true;
+}
+
+namespace {
+
+/// Raíz de x en el bosque concurrente; acorta el camino con escrituras benignas.
+uint32_t concurrentFind(std::atomic<uint32_t>* p, uint32_t x) {
+    for (;;) {
+        uint32_t px = p[x].load(std::memory_order_relaxed);
+        if (px == x) return x;
+        uint32_t ppx = p[px].load(std::memory_order_relaxed);
+        // x no es raíz, nadie más hace CAS sobre él: escribir un ancestro es seguro
+        if (ppx != px) p[x].store(ppx, std::memory_order_relaxed);
+        x = ppx;
+    }
+}
+
+} // namespace
+
+/**
+ * @brief Rebuilds the forest from a snapshot with parallel CAS-based linking.
+ * @param g Snapshot whose vertices become the elements.
+ */
+void UnionFind::rebuild(const CsrGraph& g) {
+    uint32_t n = g.numVertices();
+    std::unique_ptr<std::atomic<uint32_t>[]> p(new std::atomic<uint32_t>[n]);
+    parallelFor(n, [&](std::size_t b, std::size_t e, unsigned) {
+        for (std::size_t i = b; i < e; ++i) p[i].store(static_cast<uint32_t>(i), std::memory_order_relaxed);
+    });
+
+    // Enlace sin bloqueos: la raíz mayor se cuelga de la menor si sigue siendo raíz
+    parallelFor(n, [&](std::size_t b, std::size_t e, unsigned) {
+        for (std::size_t i = b; i < e; ++i) {
+            uint32_t u = static_cast<uint32_t>(i);
+            for (uint32_t v : g.neighbors(u)) {
+                if (v < u) continue;                 // cada arista una vez
+                for (;;) {
+                    uint32_t ru = concurrentFind(p.get(), u);
+                    uint32_t rv = concurrentFind(p.get(), v);
+                    if (ru == rv) break;
+                    uint32_t hi = ru > rv ? ru : rv;
+                    uint32_t lo = ru ^ rv ^ hi;
+                    uint32_t expected = hi;
+                    if (p[hi].compare_exchange_weak(expected, lo, std::memory_order_relaxed))
+                        break;
+                }
+            }
+        }
+    });
+
+    // Aplanar: cada elemento apunta directamente a su raíz
+    parent.resize(n);
+    parallelFor(n, [&](std::size_t b, std::size_t e, unsigned) {
+        for (std::size_t i = b; i < e; ++i) parent[i] = concurrentFind(p.get(), static_cast<uint32_t>(i));
+    });
+    rnk.assign(n, 0);
+    merged = 0;
+    for (uint32_t i = 0; i < n; ++i) {
+        if (parent[i] != i) {
+            rnk[parent[i]] = 1;
+            ++merged;
+        }
+    }
+}
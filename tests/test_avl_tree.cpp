@@ -0,0 +1,127 @@
+/**
+ * @file test_avl_tree.cpp
+ * @brief Unit tests for the order-statistic AVLTree: insert/update/erase, rank, range and topK against a sorted reference.
+ */
+#include <cassert>
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+#include "../include/avl_tree.h"
+
+/// Referencia: pares (puntaje, usuario) en orden descendente.
+using Ref = std::set<std::pair<int, int>, std::greater<std::pair<int, int>>>;
+
+/**
+ * @brief Checks every query of the tree against the reference.
+ */
+static void checkAgainst(const AVLTree& t, const Ref& ref, const std::map<int, int>& scores) {
+    assert(t.size() == static_cast<int>(ref.size()));
+    std::vector<int> all;
+    for (const auto& e : ref) all.push_back(e.second);
+    assert(t.topK(static_cast<int>(ref.size()) + 3) == all);
+    int pos = 1;
+    for (const auto& e : ref) {
+        assert(t.rank(e.second) == pos++);
+        assert(t.contains(e.second) && t.score(e.second) == e.first);
+    }
+    for (int lo = -2; lo <= 22; lo += 6) {
+        int hi = lo + 5;
+        std::vector<int> expect;
+        for (const auto& e : ref)
+            if (e.first >= lo && e.first <= hi) expect.push_back(e.second);
+        assert(t.range(lo, hi) == expect);
+    }
+    for (const auto& s : scores) assert(t.contains(s.first));
+}
+
+/**
+ * @brief Executes unit tests for AVLTree.
+ * @return 0 on success.
+ */
+int main() {
+    // -------- Operaciones aleatorias contra un std::set --------
+    {
+        std::mt19937 rng(5);
+        AVLTree t;
+        Ref ref;
+        std::map<int, int> scores;
+        for (int step = 0; step < 4000; ++step) {
+            int user = static_cast<int>(rng() % 300);
+            int score = static_cast<int>(rng() % 20);
+            auto it = scores.find(user);
+            switch (rng() % 3) {
+            case 0:                                      // insert (también actualiza)
+                if (it != scores.end()) ref.erase({it->second, user});
+                t.insert(user, score);
+                ref.insert({score, user});
+                scores[user] = score;
+                break;
+            case 1:                                      // update solo si existe
+                assert(t.update(user, score) == (it != scores.end()));
+                if (it != scores.end()) {
+                    ref.erase({it->second, user});
+                    ref.insert({score, user});
+                    it->second = score;
+                }
+                break;
+            default:                                     // erase
+                assert(t.erase(user) == (it != scores.end()));
+                if (it != scores.end()) {
+                    ref.erase({it->second, user});
+                    scores.erase(it);
+                }
+                assert(!t.contains(user) && t.rank(user) == -1);
+            }
+            if (step % 97 == 0) checkAgainst(t, ref, scores);
+        }
+        checkAgainst(t, ref, scores);
+    }
+
+    // -------- Ranking con eventos +1 / -1 --------
+    {
+        AVLTree board;
+        for (int u = 1; u <= 5; ++u) board.insert(u, 0);
+        for (int i = 0; i < 3; ++i) board.insert(4, board.score(4) + 1);
+        board.insert(2, board.score(2) + 1);
+        assert(board.rank(4) == 1 && board.rank(2) == 2);
+        assert(board.topK(2) == std::vector<int>({4, 2}));
+        board.update(4, 0);
+        assert(board.rank(2) == 1 && board.rank(4) == 3);   // empate en 0: mayor ID primero
+        assert(board.range(0, 0) == std::vector<int>({5, 4, 3, 1}));
+        assert(board.topK(-1).empty());
+    }
+
+    // -------- Nodos reciclados y movimiento --------
+    {
+        Arena scratch;
+        AVLTree t(scratch);
+        for (int u = 0; u < 1000; ++u) t.insert(u, u % 7);
+        uint64_t made = scratch.stats().allocations;
+        for (int u = 0; u < 500; ++u) t.erase(u);
+        for (int u = 1000; u < 1500; ++u) t.insert(u, u % 7);
+        assert(scratch.stats().allocations == made);        // reutiliza los nodos borrados
+        AVLTree moved(std::move(t));
+        assert(moved.size() == 1000 && t.size() == 0 && moved.rank(1499) > 0);
+        AVLTree own;
+        own.insert(1, 1);
+        own = std::move(moved);
+        assert(own.size() == 1000 && !own.contains(1));
+    }
+    {
+        // Mover entre árboles de la misma arena no debe rebobinarla bajo los nodos movidos
+        Arena shared;
+        AVLTree a(shared);
+        AVLTree b(shared);
+        a.insert(1, 10);
+        for (int u = 100; u < 400; ++u) b.insert(u, u);
+        a = std::move(b);
+        for (int u = 1000; u < 1300; ++u) a.insert(u, -u);   // nodos nuevos tras el movimiento
+        assert(a.size() == 600 && a.contains(399) && a.rank(399) == 1);
+        assert(a.topK(3) == std::vector<int>({399, 398, 397}));
+    }
+    return 0;
+}
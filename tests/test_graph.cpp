@@ -3,7 +3,48 @@
  * @brief Unit tests for Graph class: checks edge addition, symmetry, degree, and component counting.
  */
 #include <cassert>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <stdexcept>
 #include "../include/graph.h"
+#include "../include/binary_snapshot.h"
+#include "../include/json_stream.h"
+#include "../include/multi_bfs.h"
+#include "../include/bfs_engine.h"
+
+/// Generador xorshift64: la misma semilla da siempre la misma secuencia.
+struct XorShift {
+    uint64_t x;
+    explicit XorShift(uint64_t seed) : x(seed) {}
+    uint64_t operator()() { x ^= x << 13; x ^= x >> 7; x ^= x << 17; return x; }
+};
+
+/// Grafo con m aristas aleatorias entre IDs de [0, n) (puede haber bucles y repetidas), cargado con addEdges.
+static Graph randomGraph(XorShift& rnd, uint64_t n, std::size_t m) {
+    std::vector<std::pair<uint64_t, uint64_t>> es;
+    for (std::size_t i = 0; i < m; ++i) es.emplace_back(rnd() % n, rnd() % n);
+    Graph g;
+    g.addEdges(es);
+    return g;
+}
+
+/// Distancias desde src con un BFS simple sobre el snapshot (-1 = inalcanzable).
+static std::vector<int> referenceDistances(const CsrGraph& view, uint32_t src) {
+    std::vector<int> d(view.numVertices(), -1);
+    std::vector<uint32_t> qu{src};
+    d[src] = 0;
+    for (std::size_t h = 0; h < qu.size(); ++h)
+        for (uint32_t w : view.neighbors(qu[h]))
+            if (d[w] < 0) { d[w] = d[qu[h]] + 1; qu.push_back(w); }
+    return d;
+}
 
 /**
  * @brief Executes unit tests to verify the Graph implementation.
@@ -34,6 +75,541 @@ int main() {
     // -------- Component count tests -----
     // Esperamos 2 componentes conexas: {1,2,3} y {10,11}
     assert(g.bfsComponentCount() == 2);
+    assert(g.componentCount() == 2);
+    assert(g.sameComponent(1, 3) && !g.sameComponent(1, 11));
+
+    // -------- CSR snapshot tests --------
+    auto view = g.snapshot();
+    assert(view->numVertices() == 5);
+    assert(view->numEdges() == 4);
+    uint32_t i1 = g.idMap().find(1);
+    uint32_t i3 = g.idMap().find(3);
+    assert(g.idMap().external(i1) == 1);
+    assert(view->degree(i1) == 2);
+    assert(view->hasEdge(i1, i3) && view->hasEdge(i3, i1));
+    assert(g.idMap().find(42) == IdMap::NONE);
+    assert(g.shortestPath(1, 11) == -1);
+    assert(g.averageClusteringCoefficient() == 1.0);
+
+    // El snapshot se invalida al agregar aristas
+    g.addEdge(3, 10);
+    assert(g.snapshot() != view);
+    assert(g.bfsComponentCount() == 1);
+    assert(g.componentCount() == 1 && g.sameComponent(1, 11));
+    assert(g.shortestPath(1, 11) == 3);
+
+    // -------- 64-bit ID tests --------
+    // IDs que comparten los 32 bits bajos no deben confundirse
+    const uint64_t big = (1ULL << 40) + 7;
+    g.addEdge(big, 7);
+    assert(g.areFriends(big, 7));
+    assert(!g.areFriends(7, 7));
+    assert(g.degree(big) == 1);
+    assert(g.neighbors(7).size() == 1 && g.neighbors(7)[0] == big);
+    assert(g.shortestPath(big, 7) == 1);
+
+    // -------- Remove user tests --------
+    // 3 une ambas componentes; al eliminarlo 10-11 vuelve a quedar aislada
+    int edgesBefore = g.numEdges();
+    assert(g.removeUser(3));
+    assert(!g.areFriends(1, 3) && !g.areFriends(3, 10));
+    assert(g.degree(3) == 0);
+    assert(g.numEdges() == edgesBefore - 3);
+    assert(g.shortestPath(1, 11) == -1);
+    assert(g.bfsComponentCount() == 3);
+    assert(g.componentCount() == 3 && !g.sameComponent(1, 11));
+    assert(!g.removeUser(3));
+    g.removeUser(big);                  // 7 queda sin amistades y deja de ser vértice
+    assert(g.numVertices() == 4);
+
+    // -------- Leaderboard tests --------
+    {
+        Graph lb;
+        for (uint64_t f = 100; f < 105; ++f) lb.follow(f, 7);     // 7: 5 seguidores
+        lb.follow(100, 8);
+        lb.follow(101, 8);                                        // 8: 2 seguidores
+        lb.follow(100, 9);                                        // 9: 1 seguidor
+        lb.follow(100, 9);                                        // repetido: no cuenta
+        auto top = lb.mostFollowed(2);
+        assert(top.size() == 2 && top[0] == std::make_pair(uint64_t(7), 5) && top[1].first == 8);
+        assert(lb.followerRank(9) == 3 && lb.followerRank(100) == -1);
+        lb.unfollow(100, 7);
+        lb.unfollow(101, 7);
+        lb.unfollow(102, 7);
+        lb.unfollow(102, 7);                                      // ya no lo seguía
+        // empate a 2: primero la clave de ranking más reciente (8)
+        assert(lb.mostFollowed(2) == (std::vector<std::pair<uint64_t, int>>{{8, 2}, {7, 2}}));
+        lb.unfollow(100, 9);
+        assert(lb.followerRank(9) == -1 && lb.mostFollowed(10).size() == 2);
+        lb.removeUser(7);
+        assert(lb.followerRank(7) == -1 && lb.followerRank(8) == 1);
+
+        uint64_t p8 = lb.addPost(8, "hola");
+        uint64_t p9 = lb.addPost(9, "adiós");
+        lb.likePost(p9);
+        lb.likePost(p8);
+        lb.likePost(p8);
+        assert(lb.likeRank(8) == 1 && lb.likeRank(9) == 2);
+        assert(lb.mostLiked(5) == (std::vector<std::pair<uint64_t, int>>{{8, 2}, {9, 1}}));
+        // Los rankings no crean vértices en el grafo de amistades
+        assert(lb.snapshot()->numVertices() == 0 && lb.idMap().size() == 0);
+    }
+    {
+        Graph lb;
+        lb.addEdge(1, 2);
+        lb.addEdge(2, 3);
+        auto view = lb.snapshot();
+        lb.follow(1, 777);
+        lb.follow(1, 888);
+        lb.likePost(lb.addPost(999, "hola"));
+        assert(lb.snapshot() == view && view->numVertices() == 3);
+        assert(lb.followerRank(777) > 0 && lb.likeRank(999) == 1);
+        assert(lb.removeUser(888) && lb.followerRank(888) == -1 && lb.getFollowing(1).size() == 1);
+    }
+
+    // -------- Post tests --------
+    {
+        Graph pg;
+        pg.addEdge(1, 2);
+        pg.addEdge(1, 3);
+        uint64_t a = pg.addPost(1, "uno");
+        uint64_t b = pg.addPost(1, "dos");          // mismo segundo: IDs distintos
+        uint64_t c = pg.addPost(2, "tres");
+        pg.addPost(4, "cuatro");                    // no es amigo de 1
+        assert(a != b && b < c && pg.getPost(b)->text == "dos");
+        assert(pg.likePost(b) && pg.getPost(b)->likes == 1 && pg.getPost(a)->likes == 0);
+        assert(pg.addComment(a, "bien") && pg.getPost(a)->comments == 1);
+        assert(pg.getComments(a, 10).comments[0].text == "bien" && pg.getComments(b, 10).comments.empty());
+        assert(!pg.likePost(999) && !pg.addComment(0, "x") && !pg.getPost(999));
+        std::vector<Post> mine = pg.getPostsForUser(1);
+        assert(mine.size() == 2 && mine[0].id == a && mine[1].id == b);
+        assert(pg.getPostsForUser(3).empty());
+        std::vector<Post> feed = pg.getFeed(1);
+        assert(feed.size() == 3);
+        for (const Post& p : feed) assert(p.userId != 4);
+        assert(feed[0].id == c && feed[2].id == a);     // más reciente primero
+    }
+
+    // -------- Paginated feed tests --------
+    {
+        Graph fg;
+        std::mt19937 rng(9);
+        for (uint64_t f = 2; f <= 30; ++f) fg.addEdge(1, f);
+        std::vector<uint64_t> expect;                   // posts de 1 y sus amigos
+        for (int i = 0; i < 2000; ++i) {
+            uint64_t author = 1 + rng() % 40;           // 31..40 no son amigos de 1
+            uint64_t id = fg.addPost(author, "p");
+            if (author <= 30) expect.push_back(id);
+        }
+        std::reverse(expect.begin(), expect.end());
+        for (std::size_t limit : {1, 7, 100, 5000}) {
+            std::vector<uint64_t> got;
+            FeedPage page = fg.feedPage(1, limit);
+            while (true) {
+                assert(page.posts.size() <= limit);
+                got.insert(got.end(), page.posts.begin(), page.posts.end());
+                if (!page.more) break;
+                assert(page.posts.size() == limit);
+                page = fg.feedPage(1, limit, page.next);
+            }
+            assert(got == expect);
+        }
+        // Posts nuevos no desplazan la página siguiente
+        FeedPage first = fg.feedPage(1, 10);
+        fg.addPost(1, "nuevo");
+        FeedPage second = fg.feedPage(1, 10, first.next);
+        assert(second.posts[0] == expect[10]);
+        assert(fg.feedPage(99, 10).posts.empty() && !fg.feedPage(99, 10).more);
+    }
+
+    // -------- Zero-copy view tests --------
+    {
+        Graph vg;
+        for (uint64_t f = 2; f <= 6; ++f) vg.addEdge(1, f);
+        vg.follow(1, 9);
+        vg.follow(2, 9);
+        std::vector<uint64_t> expect;
+        for (int i = 0; i < 50; ++i) expect.push_back(vg.addPost(2 + i % 8, "p"));   // 7 y 8 no son fuentes de 1
+        expect.erase(std::remove_if(expect.begin(), expect.end(),
+                                    [&](uint64_t id) { uint64_t a = vg.getPost(id)->userId; return a == 7 || a == 8; }),
+                     expect.end());
+        std::reverse(expect.begin(), expect.end());
+        for (std::size_t limit : {1, 4, 100}) {
+            std::vector<uint64_t> got;
+            uint64_t cursor = 0;
+            do {
+                std::size_t n = 0;
+                cursor = vg.forEachFeedPost(1, limit, [&](const Post& p) { got.push_back(p.id); ++n; }, cursor);
+                assert(n <= limit);
+            } while (cursor);
+            assert(got == expect);
+        }
+        IdSpan mine = vg.postIdsOf(9);
+        assert(mine.size() == vg.getPostsForUser(9).size() && vg.getPost(mine[0])->userId == 9);
+        assert(vg.postIdsOf(42).empty());
+        IdSpan fol = vg.followersOf(9);
+        assert(std::vector<uint64_t>(fol.begin(), fol.end()) == vg.getFollowers(9));
+        assert(vg.followingOf(1).size() == 1 && vg.followingOf(1)[0] == 9 && vg.followersOf(1).empty());
+    }
+
+    // -------- Path reconstruction tests --------
+    {
+        Graph pg;
+        // Dos caminos de 1 a 6: 1-2-3-4-6 (4 saltos) y 1-5-6 (2 saltos)
+        pg.addEdges({{1, 2}, {2, 3}, {3, 4}, {4, 6}, {1, 5}, {5, 6}, {7, 8}});
+        std::vector<uint64_t> r = pg.shortestPathRoute(1, 6);
+        assert((r == std::vector<uint64_t>{1, 5, 6}));
+        assert(pg.shortestPathRoute(6, 1).size() == 3);
+        assert((pg.shortestPathRoute(3, 3) == std::vector<uint64_t>{3}));
+        assert(pg.shortestPathRoute(1, 7).empty());
+        assert(pg.shortestPathRoute(1, 99).empty());
+        assert(pg.shortestPath(1, 4) == 3 && pg.shortestPath(2, 6) == 3);
+
+        // Contra un BFS unidireccional en un grafo aleatorio
+        XorShift rnd(12345);
+        Graph rg = randomGraph(rnd, 400, 900);
+        auto view = rg.snapshot();
+        for (int q = 0; q < 200; ++q) {
+            uint64_t a = rnd() % 400, b = rnd() % 400;
+            uint32_t ia = rg.idMap().find(a), ib = rg.idMap().find(b);
+            int expected = -1;
+            if (a == b) {
+                expected = 0;
+            } else if (ia != IdMap::NONE && ib != IdMap::NONE) {
+                expected = referenceDistances(*view, ia)[ib];
+            }
+            assert(rg.shortestPath(a, b) == expected);
+            std::vector<uint64_t> route = rg.shortestPathRoute(a, b);
+            assert(static_cast<int>(route.size()) - 1 == expected);
+            for (std::size_t i = 1; i < route.size(); ++i)
+                assert(rg.areFriends(route[i - 1], route[i]));
+        }
+    }
+
+    // -------- Multi-source BFS tests --------
+    {
+        // Camino 1-2-...-10: diámetro 9; con todas las fuentes el muestreo es exacto
+        Graph line;
+        for (uint64_t v = 1; v < 10; ++v) line.addEdge(v, v + 1);
+        assert(line.approximateDiameter(10) == 9);
+        assert(line.approximateDiameter(1) >= 5);
+
+        std::vector<std::vector<int>> d = line.distances({1, 5, 77}, {10, 5, 1});
+        assert((d[0] == std::vector<int>{9, 4, 0}));
+        assert((d[1] == std::vector<int>{5, 0, 4}));
+        assert((d[2] == std::vector<int>{-1, -1, -1}));
+
+        // Más de 64 fuentes (dos barridos) contra el BFS punto a punto
+        XorShift rnd(4242);
+        Graph rg = randomGraph(rnd, 500, 700);
+        std::vector<uint64_t> src, dst;
+        for (int i = 0; i < 100; ++i) src.push_back(rnd() % 520);
+        for (int i = 0; i < 30; ++i) dst.push_back(rnd() % 520);
+        std::vector<std::vector<int>> m = rg.distances(src, dst);
+        for (std::size_t i = 0; i < src.size(); ++i)
+            for (std::size_t j = 0; j < dst.size(); ++j) {
+                int expected = rg.idMap().find(src[i]) == IdMap::NONE ? -1 : rg.shortestPath(src[i], dst[j]);
+                assert(m[i][j] == expected);
+            }
+
+        auto view = rg.snapshot();
+        std::vector<uint32_t> all;
+        for (uint32_t v = 0; v < view->numVertices(); ++v) all.push_back(v);
+        MultiSourceBfs bfs(*view);
+        std::vector<uint32_t> ecc = bfs.eccentricities(all);
+        uint32_t diam = 0;
+        for (uint32_t v = 0; v < view->numVertices(); ++v) {
+            // Excentricidad con un BFS simple
+            std::vector<int> dv = referenceDistances(*view, v);
+            uint32_t e = static_cast<uint32_t>(*std::max_element(dv.begin(), dv.end()));
+            assert(ecc[v] == e);
+            diam = std::max(diam, e);
+        }
+        assert(rg.approximateDiameter(static_cast<int>(all.size())) == static_cast<int>(diam));
+    }
+
+    // -------- Direction-optimizing BFS tests --------
+    {
+        // Denso pequeño (un hilo) y grande (pasos repartidos entre hilos)
+        XorShift rnd(99);
+        for (uint64_t nv : {3000u, 40000u}) {
+            Graph rg = randomGraph(rnd, nv, nv * 10);
+            for (uint64_t v = nv; v < nv + 20; ++v) rg.addEdge(v, v + 1);      // componente aparte
+            auto view = rg.snapshot();
+            uint32_t n = view->numVertices();
+            BfsEngine fast, plain;
+            plain.setDirectionOptimizing(false);
+            for (int round = 0; round < 4; ++round) {
+                uint32_t s = static_cast<uint32_t>(rnd() % n);
+                uint32_t ecc = fast.run(*view, s);
+                assert(plain.run(*view, s) == ecc);
+                assert(plain.lastBottomUpSteps() == 0);
+                if (view->degree(s) > 0 && fast.order().size() > n / 2) assert(fast.lastBottomUpSteps() > 0);
+                assert(fast.order().size() == plain.order().size() && fast.levels() == ecc + 1);
+                for (uint32_t v = 0; v < n; ++v) {
+                    assert(fast.distance(v) == plain.distance(v));
+                    if (fast.distance(v) > 0) {
+                        uint32_t p = fast.parent(v);
+                        assert(fast.distance(p) == fast.distance(v) - 1 && view->hasEdge(p, v));
+                    }
+                }
+            }
+
+            // Profundidad limitada y varias fuentes
+            std::vector<uint32_t> srcs{0, 1, n - 1};
+            fast.run(*view, srcs, 2);
+            plain.run(*view, srcs);
+            for (uint32_t v = 0; v < n; ++v) {
+                int d = plain.distance(v);
+                assert(fast.distance(v) == (d >= 0 && d <= 2 ? d : -1));
+            }
+        }
+    }
+
+    // -------- Exact diameter tests --------
+    {
+        Graph empty;
+        assert(empty.exactDiameter().diameter == 0 && empty.eccentricity(1) == -1);
+
+        // Camino largo 1..40 junto a una componente densa: gana el camino
+        Graph two;
+        for (uint64_t v = 1; v < 40; ++v) two.addEdge(v, v + 1);
+        for (uint64_t v = 100; v < 130; ++v) two.addEdge(v, 100 + (v * 7) % 30);
+        assert(two.exactDiameter().diameter == 39);
+        assert(two.eccentricity(1) == 39 && two.eccentricity(20) == 20);
+
+        // Grafos aleatorios (dispersos y densos, con varias componentes) contra el máximo de excentricidades
+        XorShift rnd(777);
+        for (int round = 0; round < 12; ++round) {
+            uint64_t nv = 50 + rnd() % 400;
+            uint64_t ne = nv * (1 + round % 3) / 2 + rnd() % 50;
+            Graph rg = randomGraph(rnd, nv, ne);
+            auto view = rg.snapshot();
+            std::vector<uint32_t> all;
+            for (uint32_t v = 0; v < view->numVertices(); ++v) all.push_back(v);
+            std::vector<uint32_t> ecc = MultiSourceBfs(*view).eccentricities(all);
+            uint32_t diam = all.empty() ? 0 : *std::max_element(ecc.begin(), ecc.end());
+            DiameterStats st = rg.exactDiameter();
+            assert(st.diameter == diam);
+            assert(st.bfsRuns >= 3 || diam == 0);
+            uint64_t probe = rg.idMap().external(all[rnd() % all.size()]);
+            assert(rg.eccentricity(probe) == static_cast<int>(ecc[rg.idMap().find(probe)]));
+        }
+    }
+
+    // -------- Triangle tests --------
+    {
+        // K4 {1,2,3,4} + triángulo colgante 4-5-6 + arista 6-7
+        Graph tg;
+        tg.addEdges({{1, 2}, {1, 3}, {1, 4}, {2, 3}, {2, 4}, {3, 4},
+                     {4, 5}, {5, 6}, {4, 6}, {6, 7}});
+        assert(tg.triangleCount() == 5);
+        assert(tg.mutualFriendCount(1, 2) == 2 && tg.mutualFriendCount(4, 5) == 1);
+        assert((tg.mutualFriends(1, 4) == std::vector<uint64_t>{2, 3}));
+        assert(tg.mutualFriendCount(1, 99) == 0 && tg.mutualFriends(7, 1).empty());
+        assert(tg.localClustering(1) == 1.0);
+        assert(tg.localClustering(4) == 4.0 / 10.0);   // grado 5: 4 de 10 pares
+        assert(tg.localClustering(6) == 1.0 / 3.0);
+        assert(tg.localClustering(7) == 0.0 && tg.localClustering(99) == 0.0);
+        double avg = (1 + 1 + 1 + 0.4 + 1 + 1.0 / 3.0) / 6;
+        assert(std::abs(tg.averageClusteringCoefficient() - avg) < 1e-12);
+        // triples: 3+3+3+10+1+3 = 23
+        assert(std::abs(tg.transitivity() - 15.0 / 23.0) < 1e-12);
+        // Un perfil nuevo amplía el snapshot y la caché se recalcula
+        tg.addUser(User(50, "nuevo", 20, "Lima", {}, "n@x.com", "pw"));
+        assert(tg.localClustering(50) == 0.0);
+        tg.addEdge(5, 7);
+        assert(tg.triangleCount() == 6);
+
+        // Contra el conteo por pares de vecinos en un grafo aleatorio
+        XorShift rnd(99);
+        Graph rg = randomGraph(rnd, 300, 3000);
+        uint64_t naive = 0;
+        double sumC = 0;
+        int counted = 0;
+        auto view = rg.snapshot();
+        for (uint32_t i = 0; i < view->numVertices(); ++i) {
+            uint64_t u = rg.idMap().external(i);
+            FriendRange nb = rg.neighbors(u);
+            uint64_t links = 0;
+            for (std::size_t a = 0; a < nb.size(); ++a)
+                for (std::size_t b = a + 1; b < nb.size(); ++b)
+                    links += rg.areFriends(nb[a], nb[b]);
+            naive += links;
+            if (nb.size() >= 2) {
+                double c = links / (nb.size() * (nb.size() - 1) / 2.0);
+                assert(std::abs(rg.localClustering(u) - c) < 1e-12);
+                sumC += c;
+                ++counted;
+            }
+        }
+        assert(rg.triangleCount() * 3 == naive);
+        assert(std::abs(rg.averageClusteringCoefficient() - sumC / counted) < 1e-12);
+    }
+
+    // -------- Union-find tests --------
+    {
+        // Incremental, por lotes pequeños/grandes y tras borrados, contra el BFS
+        Graph ug;
+        XorShift rnd(777);
+        for (int round = 0; round < 6; ++round) {
+            for (int i = 0; i < 150; ++i) ug.addEdge(rnd() % 2000, rnd() % 2000);
+            assert(ug.componentCount() == ug.bfsComponentCount());
+            std::vector<std::pair<uint64_t, uint64_t>> batch;
+            int size = round % 2 ? 20 : 600;
+            for (int i = 0; i < size; ++i) batch.emplace_back(rnd() % 2000, rnd() % 2000);
+            ug.addEdges(batch);
+            assert(ug.componentCount() == ug.bfsComponentCount());
+            ug.removeUser(rnd() % 2000);
+            assert(ug.componentCount() == ug.bfsComponentCount());
+        }
+        auto view = ug.snapshot();
+        UnionFind uf;
+        uf.rebuild(*view);
+        for (int q = 0; q < 300; ++q) {
+            uint64_t p = rnd() % 2000, r = rnd() % 2000;
+            bool bfs = ug.shortestPath(p, r) >= 0;
+            assert(ug.sameComponent(p, r) == bfs);
+            uint32_t ip = ug.idMap().find(p), ir = ug.idMap().find(r);
+            if (ip != IdMap::NONE && ir != IdMap::NONE) assert(uf.connected(ip, ir) == bfs);
+        }
+        // Un perfil sin amistades registrado después es su propio conjunto
+        ug.addUser(User(90000, "nuevo", 20, "Lima", {}, "n@x.com", "pw"));
+        uint32_t past = uf.size();
+        assert(uf.root(past) == past && !uf.connected(0, past));
+        assert(!ug.sameComponent(90000, 1) && ug.sameComponent(90000, 90000));
+    }
+
+    // -------- Bulk load tests --------
+    Graph b;
+    b.addEdge(1, 2);
+    b.addEdges({{1, 2}, {2, 1}, {2, 3}, {3, 3}, {3, 4}, {3, 4}, {5, 6}});
+    assert(b.numEdges() == 4);          // 1-2 ya existía; duplicados y bucles se ignoran
+    assert(b.numVertices() == 6);
+    assert(b.degree(2) == 2 && b.degree(3) == 2);
+    assert(b.areFriends(4, 3) && b.areFriends(6, 5));
+    assert(!b.areFriends(3, 3));
+    assert(b.shortestPath(1, 4) == 3);
+    assert(b.bfsComponentCount() == 2);
+
+    // -------- CSV loader tests --------
+    const char* csv = "test_graph_edges.csv";
+    {
+        std::ofstream f(csv);
+        f << "1,2\n\n 2 , 3\r\nx,4\n3,4,extra\n5\n";
+    }
+    Graph c;
+    CsvLoadStats st = c.loadCSV(csv);
+    std::remove(csv);
+    assert(st.rows == 3);
+    assert(st.malformed == 2);          // "x,4" y "5"
+    assert(c.numEdges() == 3);
+    assert(c.areFriends(2, 3) && c.areFriends(3, 4));
+
+    // -------- Streaming JSON tests --------
+    {
+        Graph jg;
+        jg.addUser(User(1, "lu\"cía", 22, "Arequipa", {"a;b", "ñ"}, "l@x.com", "p\n1", "f.png"));
+        jg.addUser(User(2, "beto", 40, "Lima", {}, "b@x.com", "p2"));
+        jg.addEdges({{1, 2}, {2, 30}, {30, 31}});    // 30 y 31 no tienen perfil
+        std::stringstream ss;
+        jg.writeJson(ss);
+        nlohmann::json dom = nlohmann::json::parse(ss.str());
+        assert(dom["users"].size() == 2 && dom["edges"] == jg.toJson()["edges"]);
+        ss.seekg(0);
+        Graph r = Graph::readJson(ss);
+        assert(r.numEdges() == 3 && r.areFriends(30, 31) && r.areFriends(2, 1));
+        User* u = r.getUser(1);
+        assert(u && u->name == "lu\"cía" && u->password == "p\n1" && u->profilePic == "f.png");
+        assert(u->tags.size() == 2 && u->tags[1] == "ñ");
+        assert(r.usernameExists("beto") && r.nextUserId() == 3);
+
+        // Formato de toJson, claves desconocidas y lotes de aristas
+        std::stringstream big;
+        big << R"({"meta":{"users":[1]},"users":[{"id":5,"name":"x","age":1,"city":"c",)"
+            << R"("tags":[],"email":"e","password":"p","extra":[[1]]}],"edges":[)";
+        const int n = static_cast<int>(GraphJsonReader::BATCH) + 10;
+        for (int i = 0; i < n; ++i) big << (i ? "," : "") << '[' << i << ',' << i + 1 << ']';
+        big << "]}";
+        Graph p = Graph::readJson(big);
+        assert(p.numEdges() == n && p.getUser(5) && p.getUser(5)->name == "x");
+        assert(p.shortestPath(0, n) == n);
+
+        // Errores
+        const char* bad[] = {
+            R"({"users":[{"id":1}]})",                       // faltan campos
+            R"({"edges":[[1,2,3]]})",                        // arista de 3
+            R"({"edges":[[1,2]})",                           // JSON truncado
+        };
+        for (const char* b : bad) {
+            std::stringstream bs(b);
+            bool threw = false;
+            try { Graph::readJson(bs); } catch (const std::runtime_error&) { threw = true; }
+            assert(threw);
+        }
+    }
+
+    // -------- Binary snapshot tests --------
+    const char* bin = "test_graph_snapshot.bin";
+    c.addUser(User(3, "ana", 30, "Lima", {"cine", "rock"}, "ana@x.com", "pw"));
+    c.addUser(User(big, "solo", 20, "Cusco", {}, "s@x.com", "pw2", "pic.png"));
+    c.saveBinary(bin);
+    {
+        Graph r = Graph::loadBinary(bin);
+        assert(r.numEdges() == c.numEdges());
+        assert(r.numVertices() == c.numVertices());
+        assert(r.areFriends(3, 2) && r.areFriends(4, 3) && !r.areFriends(1, 4));
+        assert(r.shortestPath(1, 4) == 3);
+        User* a = r.getUser(3);
+        assert(a && a->name == "ana" && a->age == 30 && a->city == "Lima");
+        assert(a->tags.size() == 2 && a->tags[1] == "rock" && a->verifyPassword("pw"));
+        User* s = r.getUser(big);
+        assert(s && s->profilePic == "pic.png" && s->tags.empty());
+        assert(r.usernameExists("solo"));
+        assert(r.nextUserId() == big + 1);
+        // Sigue siendo mutable tras cargar
+        r.addEdge(1, 4);
+        assert(r.shortestPath(1, 4) == 1);
+    }
+    {
+        // Offsets decrecientes, vecinos fuera de rango, filas desordenadas o
+        // asimétricas, IDs repetidos y conteos forjados deben rechazarse
+        std::ifstream in(bin, std::ios::binary);
+        std::string good((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        in.close();
+        SnapshotHeader h;
+        std::memcpy(&h, good.data(), sizeof(h));
+        auto rejects = [&](uint64_t pos, auto value) {
+            std::string bad = good;
+            std::memcpy(&bad[pos], &value, sizeof(value));
+            std::ofstream(bin, std::ios::binary | std::ios::trunc) << bad;
+            try { Graph::loadBinary(bin); } catch (const std::runtime_error&) { return true; }
+            return false;
+        };
+        // Camino 1-2-3-4 más un aislado: índices densos 0..4, fila 0 = {1}
+        assert(h.numVertices == 5);
+        uint32_t nb0;
+        std::memcpy(&nb0, &good[h.neighborsPos], 4);
+        assert(nb0 == 1);
+        assert(rejects(h.offsetsPos + 4, UINT32_MAX));
+        assert(rejects(h.neighborsPos, static_cast<uint32_t>(h.numVertices)));
+        assert(rejects(h.neighborsPos, uint32_t(0)));                      // lazo 0-0
+        assert(rejects(h.neighborsPos, uint32_t(3)));                      // 0→3 sin 3→0
+        uint64_t id0;
+        std::memcpy(&id0, &good[h.idsPos], 8);
+        assert(rejects(h.idsPos + 8, id0));                                // ID repetido
+        // 2^61 perfiles: u * 56 desborda a 0 si se multiplica
+        assert(rejects(offsetof(SnapshotHeader, numUsers), uint64_t(1) << 61));
+        assert(rejects(offsetof(SnapshotHeader, numAdj), uint64_t(1) << 62));
+    }
+    {
+        std::ofstream f(bin, std::ios::binary | std::ios::trunc);
+        f << "no es un snapshot";
+    }
+    bool rejected = false;
+    try { Graph::loadBinary(bin); } catch (const std::runtime_error&) { rejected = true; }
+    std::remove(bin);
+    assert(rejected);
 
     return 0; // éxito
 }
@@ -28,5 +28,39 @@ int main() {
     // -------- Verify lookup for nonexistent key --------
     assert(!ht.containsKey(999));
 
+    // -------- Negative keys and zero do not collide --------
+    LinkedList* zero = new LinkedList();
+    LinkedList* neg = new LinkedList();
+    ht.put(0, zero);
+    ht.put(-5, neg);
+    assert(ht.get(0) == zero);
+    assert(ht.get(-5) == neg);
+    assert(ht.get(-6) == nullptr);
+
+    // -------- Capacity is a power of two; keySet lists every key --------
+    assert((ht.getCapacity() & (ht.getCapacity() - 1)) == 0);
+    assert(ht.size() == 22);
+    assert(static_cast<int>(ht.keySet().size()) == ht.size());
+
+    // -------- Many keys: all retrievable after repeated rehash --------
+    HashTable big;
+    for (int i = 0; i < 5000; ++i) big.put(i * 7919, nullptr);
+    for (int i = 0; i < 5000; ++i) assert(big.containsKey(i * 7919));
+    assert(!big.containsKey(1));
+
+    // -------- Remove: backward shift keeps every other key reachable --------
+    int grown = big.getCapacity();
+    for (int i = 0; i < 5000; i += 2) assert(big.remove(i * 7919));
+    assert(!big.remove(0));
+    assert(big.size() == 2500);
+    for (int i = 0; i < 5000; ++i) assert(big.containsKey(i * 7919) == (i % 2 == 1));
+
+    // -------- Shrink on underflow --------
+    for (int i = 1; i < 5000; i += 2) big.remove(i * 7919);
+    assert(big.size() == 0);
+    assert(big.getCapacity() < grown);
+    big.put(42, nullptr);
+    assert(big.containsKey(42));
+
     return 0;   // éxito
 }
\ No newline at end of file
@@ -0,0 +1,75 @@
+/**
+ * @file test_intersect.cpp
+ * @brief Unit tests for the sorted-set intersection kernels: every kernel against std::set_intersection.
+ */
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+#include <random>
+#include <vector>
+#include "../include/intersect.h"
+
+/// Genera n valores distintos y ordenados en [0, range).
+static std::vector<uint32_t> sortedSet(std::mt19937& rng, std::size_t n, uint32_t range) {
+    std::vector<uint32_t> v;
+    for (std::size_t i = 0; i < n; ++i) v.push_back(rng() % range);
+    std::sort(v.begin(), v.end());
+    v.erase(std::unique(v.begin(), v.end()), v.end());
+    return v;
+}
+
+/**
+ * @brief Checks count and materialize results of all kernels on one pair of lists.
+ */
+static void checkPair(const std::vector<uint32_t>& a, const std::vector<uint32_t>& b) {
+    std::vector<uint32_t> expected;
+    std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+    std::size_t n = expected.size();
+
+    assert(intersectCount(a.data(), a.size(), b.data(), b.size()) == n);
+    assert(intersectCountScalar(a.data(), a.size(), b.data(), b.size()) == n);
+    assert(intersectCountGalloping(a.data(), a.size(), b.data(), b.size()) == n);
+    assert(intersectCountGalloping(b.data(), b.size(), a.data(), a.size()) == n);
+    assert(intersectCountAvx2(a.data(), a.size(), b.data(), b.size()) == n);
+
+    std::vector<uint32_t> out(std::min(a.size(), b.size()) + 1, 0xdeadbeef);
+    using Kernel = std::size_t (*)(const uint32_t*, std::size_t, const uint32_t*, std::size_t, uint32_t*);
+    Kernel kernels[] = {intersect, intersectScalar, intersectGalloping, intersectAvx2};
+    for (Kernel k : kernels) {
+        std::fill(out.begin(), out.end(), 0xdeadbeef);
+        assert(k(a.data(), a.size(), b.data(), b.size(), out.data()) == n);
+        assert(std::equal(expected.begin(), expected.end(), out.begin()));
+        assert(out[n] == 0xdeadbeef || n < out.size() - 1);   // nada escrito de más
+    }
+}
+
+/**
+ * @brief Runs the kernels on hand-picked edge cases and random lists of many shapes.
+ * @return 0 on success.
+ */
+int main() {
+    // -------- Casos borde --------
+    checkPair({}, {});
+    checkPair({1, 2, 3}, {});
+    checkPair({5}, {5});
+    checkPair({1, 2, 3, 4, 5, 6, 7, 8}, {1, 2, 3, 4, 5, 6, 7, 8});
+    checkPair({1, 2, 3, 4, 5, 6, 7, 8}, {9, 10, 11, 12, 13, 14, 15, 16});
+    checkPair({0, 4294967295u}, {4294967295u});
+    // Bloques que se solapan parcialmente (límites de 8 en AVX2)
+    checkPair({1, 3, 5, 7, 9, 11, 13, 15, 17, 19}, {2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18});
+
+    // -------- Aleatorios: balanceados, densos y muy sesgados --------
+    std::mt19937 rng(2024);
+    const std::size_t sizes[] = {1, 7, 8, 9, 15, 16, 17, 31, 64, 100, 1000, 5000};
+    for (std::size_t na : sizes) {
+        for (std::size_t nb : sizes) {
+            for (uint32_t range : {64u, 1000u, 100000u}) {
+                checkPair(sortedSet(rng, na, range), sortedSet(rng, nb, range));
+            }
+        }
+    }
+    checkPair(sortedSet(rng, 3, 1000), sortedSet(rng, 100000, 1000000));
+    checkPair(sortedSet(rng, 200000, 1000000), sortedSet(rng, 40, 1000000));
+
+    return 0; // éxito
+}
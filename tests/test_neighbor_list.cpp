@@ -0,0 +1,85 @@
+/**
+ * @file test_neighbor_list.cpp
+ * @brief Unit tests for NeighborList: sorted insert/erase, inline-to-heap growth, batch merge and copies.
+ */
+#include <cassert>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+#include "../include/neighbor_list.h"
+
+/// Compara la lista con el conjunto de referencia.
+static void same(const NeighborList& l, const std::set<uint32_t>& ref) {
+    assert(l.size() == ref.size());
+    assert(std::vector<uint32_t>(l.begin(), l.end()) == std::vector<uint32_t>(ref.begin(), ref.end()));
+}
+
+/**
+ * @brief Executes tests for NeighborList.
+ * @return 0 on success.
+ */
+int main() {
+    // -------- Inline: sin memoria dinámica --------
+    NeighborList a;
+    assert(a.empty() && a.heapBytes() == 0);
+    assert(a.insert(7) && a.insert(3) && a.insert(5) && !a.insert(3));
+    assert(a.size() == 3 && a[0] == 3 && a[1] == 5 && a[2] == 7);
+    assert(a.contains(5) && !a.contains(4));
+    assert(a.heapBytes() == 0);
+    assert(a.erase(5) && !a.erase(5) && a.size() == 2);
+
+    // -------- Operaciones aleatorias contra std::set --------
+    std::mt19937 rng(5);
+    NeighborList l;
+    std::set<uint32_t> ref;
+    for (int i = 0; i < 20000; ++i) {
+        uint32_t v = rng() % 3000;
+        if (rng() % 3) assert(l.insert(v) == ref.insert(v).second);
+        else assert(l.erase(v) == (ref.erase(v) == 1));
+        if (i % 997 == 0) same(l, ref);
+        assert(l.contains(v) == (ref.count(v) == 1));
+    }
+    same(l, ref);
+    assert(l.heapBytes() >= l.size() * sizeof(uint32_t));
+
+    // -------- Fusión por lotes (vacía, inline y en heap) --------
+    for (std::size_t start : {0u, 2u, 50u}) {
+        NeighborList m;
+        std::set<uint32_t> mref;
+        while (mref.size() < start) {
+            uint32_t v = 2 * (rng() % 1000);          // pares
+            m.insert(v);
+            mref.insert(v);
+        }
+        std::vector<uint32_t> extra;
+        for (uint32_t v = 1; v < 2000; v += 2 * (1 + rng() % 20)) extra.push_back(v);   // impares: nuevos
+        m.mergeSorted(extra.data(), extra.size());
+        mref.insert(extra.begin(), extra.end());
+        same(m, mref);
+    }
+
+    // -------- Copia, movimiento y asignación --------
+    NeighborList copy(l);
+    same(copy, ref);
+    NeighborList moved(std::move(copy));
+    same(moved, ref);
+    assert(copy.empty());
+    NeighborList small;
+    small.insert(1);
+    NeighborList small2(small);
+    small2.insert(2);
+    assert(small.size() == 1 && small2.size() == 2);
+    small = moved;                                   // inline ← heap
+    same(small, ref);
+    moved = small2;                                  // heap ← inline
+    assert(moved.size() == 2 && moved[1] == 2);
+    std::vector<NeighborList> many(3);
+    many[1] = l;
+    many.resize(1000);                               // reubicación por movimiento
+    same(many[1], ref);
+
+    l.clear();
+    assert(l.empty() && l.heapBytes() == 0 && l.insert(9) && l.contains(9));
+    return 0;
+}
@@ -0,0 +1,97 @@
+/**
+ * @file test_pool.cpp
+ * @brief Unit tests for ObjectPool and Arena, and for the structures allocating from them (AVLTree).
+ */
+#include <cassert>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "../include/pool.h"
+#include "../include/avl_tree.h"
+
+/// Tipo con contador de instancias vivas para comprobar destructores.
+struct Tracked {
+    static int alive;
+    std::string payload;
+    explicit Tracked(int v) : payload(std::to_string(v)) { ++alive; }
+    ~Tracked() { --alive; }
+};
+int Tracked::alive = 0;
+
+/**
+ * @brief Executes tests for the pool allocators.
+ * @return 0 on success.
+ */
+int main() {
+    // -------- ObjectPool: reutilización de ranuras y contadores --------
+    {
+        ObjectPool<Tracked> pool;
+        std::vector<Tracked*> objs;
+        for (int i = 0; i < 5000; ++i) objs.push_back(pool.create(i));
+        assert(Tracked::alive == 5000 && objs[1234]->payload == "1234");
+        assert(pool.stats().live == 5000 && pool.stats().allocations == 5000);
+        assert(pool.stats().bytesInUse == 5000 * sizeof(Tracked));
+        uint64_t slabs = pool.stats().chunks;
+        assert(slabs >= 2 && pool.stats().bytesReserved >= pool.stats().bytesInUse);
+
+        Tracked* freed = objs[10];
+        pool.destroy(freed);
+        assert(Tracked::alive == 4999 && pool.stats().live == 4999);
+        Tracked* again = pool.create(-1);                // toma la ranura liberada
+        assert(again == freed && again->payload == "-1");
+        objs[10] = again;
+
+        for (int i = 0; i < 2500; ++i) pool.destroy(objs[i]);
+        for (int i = 0; i < 2500; ++i) objs[i] = pool.create(i);
+        assert(pool.stats().chunks == slabs);            // sin slabs nuevos
+
+        ObjectPool<Tracked> moved(std::move(pool));
+        assert(moved.stats().live == 5000 && pool.stats().live == 0);
+        assert(objs[4999]->payload == "4999");
+    }
+    assert(Tracked::alive == 0);                         // el pool destruye lo que quedaba vivo
+
+    // -------- Arena: alineación, crecimiento y reset --------
+    {
+        Arena arena(256);
+        assert(arena.stats().chunks == 0);
+        char* c = static_cast<char*>(arena.allocate(3, 1));
+        double* d = arena.make<double>(2.5);
+        assert(reinterpret_cast<std::uintptr_t>(d) % alignof(double) == 0 && *d == 2.5 && c);
+        for (int i = 0; i < 1000; ++i) arena.make<uint64_t>(i);
+        assert(arena.stats().chunks > 1 && arena.stats().live == 1002);
+        uint64_t reserved = arena.stats().bytesReserved;
+        arena.reset();
+        assert(arena.stats().chunks == 1 && arena.stats().live == 0 && arena.stats().bytesInUse == 0);
+        assert(arena.stats().bytesReserved < reserved);
+        uint64_t* big = static_cast<uint64_t*>(arena.allocate(100000, 8));   // mayor que un bloque
+        big[99999 / 8] = 7;
+        assert(arena.stats().bytesReserved >= 100000);
+    }
+
+    // -------- Arena con tope: reset conserva el bloque más grande, no el último --------
+    {
+        Arena arena(256, 1024);
+        arena.allocate(4000, 8);                        // bloque a medida, mayor que el tope
+        arena.allocate(900, 8);                         // no cabe: bloque nuevo de 1024
+        assert(arena.stats().chunks == 2);
+        arena.reset();
+        assert(arena.stats().chunks == 1 && arena.stats().bytesReserved >= 4000);
+        arena.allocate(3000, 8);                        // cabe en el bloque conservado
+        assert(arena.stats().chunks == 1);
+    }
+
+    // -------- AVLTree sobre una arena externa: liberación en bloque --------
+    {
+        Arena scratch;
+        for (int round = 0; round < 3; ++round) {
+            AVLTree tree(scratch);
+            for (int i = 0; i < 2000; ++i) tree.insert(i, (i * 37) % 101);
+            std::vector<int> top = tree.topK(3);
+            assert(top.size() == 3);
+            assert(scratch.stats().live == 2000);
+        }
+        assert(scratch.stats().live == 0 && scratch.stats().chunks == 1);
+    }
+    return 0;
+}
@@ -0,0 +1,91 @@
+/**
+ * @file test_post_store.cpp
+ * @brief Unit tests for PostStore: arena-backed text, comment pages and the memory report.
+ */
+#include <cassert>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "../include/post_store.h"
+
+/**
+ * @brief Reads every comment of a post page by page.
+ * @return Comment texts, oldest first.
+ */
+static std::vector<std::string> readComments(const PostStore& s, uint64_t postId, std::size_t limit) {
+    std::vector<std::string> out;
+    uint64_t cursor = 0;
+    do {
+        CommentPage page = s.comments(postId, limit, cursor);
+        assert(page.comments.size() <= limit);
+        for (const Comment& c : page.comments) {
+            assert(c.postId == postId);
+            out.emplace_back(c.text);
+        }
+        if (!page.more) break;
+        assert(page.comments.size() == limit);
+        cursor = page.next;
+    } while (true);
+    return out;
+}
+
+/**
+ * @brief Executes tests for PostStore.
+ * @return 0 on success.
+ */
+int main() {
+    // -------- Texto en la arena: vistas estables al crecer --------
+    {
+        PostStore s;
+        std::string big(3000, 'x');
+        uint64_t first = s.add(1, "hola", 10);
+        const char* where = s.get(first)->text.data();
+        for (int i = 0; i < 2000; ++i) s.add(1 + i % 7, i % 2 ? big : std::to_string(i), 20 + i);   // varios bloques
+        assert(s.get(first)->text == "hola" && s.get(first)->text.data() == where);
+        assert(s.get(first + 2)->text == big && s.get(first + 1)->text == "0");
+        uint64_t empty = s.add(2, "", 0);
+        assert(s.get(empty)->text.empty() && s.get(empty)->comments == 0);
+        assert(s.byAuthor(1).front() == first && s.size() == 2002);
+    }
+
+    // -------- Comentarios: tabla aparte, paginada y por post --------
+    {
+        PostStore s;
+        uint64_t a = s.add(1, "a", 0), b = s.add(2, "b", 0);
+        std::vector<std::string> expectA, expectB;
+        for (int i = 0; i < 25; ++i) {                  // intercalados entre dos posts
+            std::string t = "c" + std::to_string(i);
+            uint64_t target = i % 3 ? a : b;
+            assert(s.addComment(target, t, i));
+            (target == a ? expectA : expectB).push_back(t);
+        }
+        assert(!s.addComment(99, "x", 0) && !s.addComment(0, "x", 0));
+        assert(s.get(a)->comments == expectA.size() && s.get(b)->comments == expectB.size());
+        for (std::size_t limit : {1, 4, 100}) {
+            assert(readComments(s, a, limit) == expectA);
+            assert(readComments(s, b, limit) == expectB);
+        }
+        CommentPage first = s.comments(a, 2);
+        assert(first.more && first.comments[1].timestamp == 2);
+        assert(s.comments(b, 5, first.next).comments.empty());   // cursor de otro post
+        assert(s.comments(99, 5).comments.empty() && !s.comments(a, 5, 1000).more);
+        uint64_t c = s.add(3, "sin comentarios", 0);
+        assert(s.comments(c, 5).comments.empty() && !s.comments(c, 5).more);
+    }
+
+    // -------- Informe de memoria --------
+    {
+        PostStore s;
+        assert(s.stats().bytesPerPost() == 0);
+        for (int i = 0; i < 1000; ++i) {
+            uint64_t id = s.add(i % 50, "un post de cuarenta bytes más o menos...", i);
+            if (i % 4 == 0) s.addComment(id, "comentario", i);
+        }
+        PostStoreStats st = s.stats();
+        assert(st.posts == 1000 && st.comments == 250);
+        assert(st.textBytes >= 1000 * 40 + 250 * 10 && st.arenaBytes >= st.textBytes);
+        assert(st.recordBytes >= 1000 * sizeof(Post) && st.indexBytes > 1000 * sizeof(uint64_t));
+        assert(st.bytesPerPost() > 40 && st.bytesPerPost() < 400);
+    }
+    return 0;
+}
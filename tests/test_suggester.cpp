@@ -0,0 +1,74 @@
+/**
+ * @file test_suggester.cpp
+ * @brief Unit tests for Suggester: mutual-friend scoring, radius limit and exclusion of existing friends.
+ */
+#include <cassert>
+#include <algorithm>
+#include "../include/suggester.h"
+
+/**
+ * @brief Executes unit tests to verify the Suggester implementation.
+ * @return 0 on success.
+ */
+int main() {
+    Graph g;
+    // 1 es amigo de 2, 3 y 4; 5 comparte dos amigos con 1, 6 solo uno; 7 está a 3 saltos
+    g.addEdge(1, 2);
+    g.addEdge(1, 3);
+    g.addEdge(1, 4);
+    g.addEdge(2, 5);
+    g.addEdge(3, 5);
+    g.addEdge(4, 6);
+    g.addEdge(6, 7);
+
+    Suggester s(&g);
+
+    // -------- Orden por amigos mutuos --------
+    std::vector<uint64_t> recs = s.suggest(1, 5, 2);
+    assert(recs.size() == 2);
+    assert(recs[0] == 5);
+    assert(recs[1] == 6);
+
+    // -------- Nunca sugiere amigos directos ni a sí mismo --------
+    for (uint64_t v : s.suggest(1, 10, 3)) {
+        assert(v != 1 && !g.areFriends(1, v));
+    }
+
+    // -------- El radio limita los candidatos --------
+    std::vector<uint64_t> far = s.suggest(1, 10, 3);
+    assert(std::find(far.begin(), far.end(), 7ULL) != far.end());
+    assert(s.suggest(1, 10, 1).empty());
+
+    // -------- Etiquetas compartidas y poda de candidatos --------
+    g.addUser(User(1, "u1", 20, "Lima", {"cine", "rock", "cine"}, "u1@x.com", "pw"));
+    g.addUser(User(7, "u7", 20, "Lima", {"rock", "cine", "rock"}, "u7@x.com", "pw"));
+    assert(s.commonTags(1, 7) == 2 && s.commonTags(1, 5) == 0);   // sin contar repetidas
+    s.setWeights(2, 5, 1);
+    std::vector<uint64_t> all = s.suggest(1, 10, 3);
+    assert(all[0] == 7);                        // 10 - 3 supera a 5 (2·2 - 2)
+    for (int k = 1; k <= static_cast<int>(all.size()); ++k) {
+        std::vector<uint64_t> top = s.suggest(1, k, 3);
+        assert(std::equal(top.begin(), top.end(), all.begin()) && top.size() == static_cast<std::size_t>(k));
+    }
+    s.setWeights(2, 1, 1);
+    assert(s.suggest(1, 1, 3) == std::vector<uint64_t>({5}));
+    assert(s.suggest(1, 0, 3).empty());
+    // Un k mayor que el grafo devuelve todos los candidatos sin reservar k entradas
+    assert(s.suggest(1, 2000000000, 3) == s.suggest(1, 10, 3));
+
+    // -------- Empates: mayor ID primero, sin importar el orden de inserción --------
+    {
+        Graph t;
+        t.addEdge(1, 2);
+        t.addEdge(2, 30);       // 30 recibe índice denso antes que 20
+        t.addEdge(2, 20);
+        Suggester ts(&t);
+        assert(ts.suggest(1, 5, 2) == std::vector<uint64_t>({30, 20}));
+        assert(ts.suggest(1, 1, 2) == std::vector<uint64_t>({30}));
+    }
+
+    // -------- Usuario inexistente --------
+    assert(s.suggest(99, 5, 3).empty());
+
+    return 0; // éxito
+}
@@ -0,0 +1,124 @@
+/**
+ * @file test_timeline.cpp
+ * @brief Unit tests for the fan-out-on-write timeline cache: cached pages must equal pull-only pages.
+ */
+#include <cassert>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "../include/graph.h"
+#include "../include/timeline_cache.h"
+
+/**
+ * @brief Reads a user's whole feed page by page.
+ * @return Post IDs, newest first.
+ */
+static std::vector<uint64_t> readAll(const Graph& g, uint64_t user, std::size_t limit) {
+    std::vector<uint64_t> out;
+    FeedPage page = g.feedPage(user, limit);
+    while (true) {
+        assert(page.posts.size() <= limit);
+        out.insert(out.end(), page.posts.begin(), page.posts.end());
+        if (!page.more) break;
+        page = g.feedPage(user, limit, page.next);
+    }
+    return out;
+}
+
+/**
+ * @brief Executes tests for TimelineCache and Graph's cached feeds.
+ * @return 0 on success.
+ */
+int main() {
+    // -------- Anillo: orden, descarte y obsolescencia --------
+    {
+        TimelineConfig cfg;
+        cfg.capacity = 4;
+        TimelineCache c(cfg);
+        c.push(0, 1);                                   // obsoleto: se ignora
+        assert(!c.fresh(0) && c.stats().pushes == 0);
+        c.rebuild(0, {3, 2}, true);
+        assert(c.fresh(0));
+        for (uint64_t id = 4; id <= 7; ++id) c.push(0, id);
+        c.push(0, 7);                                   // repetido (amigo y seguidor)
+        std::vector<PostRun> runs;
+        uint64_t floor = c.runs(0, runs);
+        std::vector<uint64_t> ids;
+        for (const PostRun& r : runs) ids.insert(ids.end(), r.ids, r.ids + r.size);
+        assert(ids == std::vector<uint64_t>({4, 5, 6, 7}) && floor == 4);
+        FeedPage p = mergeRuns(runs, 10);
+        assert(p.posts == std::vector<uint64_t>({7, 6, 5, 4}) && !p.more);
+        c.invalidate(0);
+        assert(!c.fresh(0) && c.stats().pushes == 4 && c.stats().rebuilds == 1);
+    }
+
+    // -------- Misma página con y sin caché, con operaciones aleatorias --------
+    for (std::size_t threshold : {3, 1000}) {
+        Graph pull, push;
+        TimelineConfig cfg;
+        cfg.capacity = 8;
+        cfg.celebrityThreshold = threshold;
+        push.enableTimelineCache(cfg);
+        std::mt19937 rng(static_cast<unsigned>(threshold));
+        const uint64_t USERS = 40;
+        for (int step = 0; step < 6000; ++step) {
+            uint64_t a = 1 + rng() % USERS, b = 1 + rng() % USERS;
+            unsigned op = rng() % 100;
+            if (op < 10) {
+                pull.addEdge(a, b);
+                push.addEdge(a, b);
+            } else if (op < 18) {
+                pull.follow(a, b);
+                push.follow(a, b);
+            } else if (op < 21) {
+                pull.unfollow(a, b);
+                push.unfollow(a, b);
+            } else if (op < 22 && step % 7 == 0) {
+                pull.removeUser(a);
+                push.removeUser(a);
+            } else if (op < 70) {
+                uint64_t x = pull.addPost(a, "p");
+                uint64_t y = push.addPost(a, "p");
+                assert(x == y);
+            } else {
+                std::size_t limit = 1 + rng() % 12;
+                assert(readAll(push, a, limit) == readAll(pull, a, limit));
+            }
+        }
+        for (uint64_t u = 1; u <= USERS; ++u) assert(readAll(push, u, 5) == readAll(pull, u, 5));
+        const TimelineStats& st = push.timelineCache()->stats();
+        assert(st.pushes > 0 && st.rebuilds > 0 && st.bytes > 0);
+        assert((threshold == 3) == (st.pulledPosts > 0));
+    }
+
+    // -------- Activar y desactivar --------
+    {
+        Graph g;
+        g.addEdge(1, 2);
+        uint64_t old = g.addPost(2, "antes");
+        g.enableTimelineCache();
+        uint64_t now = g.addPost(2, "después");         // 1 aún no leyó: su anillo está obsoleto
+        assert(g.feedPage(1, 10).posts == std::vector<uint64_t>({now, old}));
+        uint64_t later = g.addPost(2, "luego");         // ahora sí se difunde
+        assert(g.timelineCache()->stats().pushes == 1);
+        assert(g.feedPage(1, 1).posts == std::vector<uint64_t>({later}));
+        g.disableTimelineCache();
+        assert(!g.timelineCache() && g.feedPage(1, 10).posts.size() == 3);
+    }
+
+    // -------- Autor solo seguido: sin índice interno, se lee por pull --------
+    {
+        Graph g;
+        g.enableTimelineCache();
+        g.addEdge(1, 2);
+        g.follow(1, 50);                                // 50 no es vértice del grafo
+        uint64_t a = g.addPost(50, "a");
+        assert(g.feedPage(1, 10).posts == std::vector<uint64_t>({a}));
+        g.addEdge(50, 3);                               // 50 pasa a ser vértice y se difunde
+        uint64_t b = g.addPost(50, "b");
+        uint64_t c = g.addPost(2, "c");
+        assert(g.feedPage(1, 10).posts == std::vector<uint64_t>({c, b, a}));
+        assert(g.snapshot()->numVertices() == 4);
+    }
+    return 0;
+}
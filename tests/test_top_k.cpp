@@ -0,0 +1,108 @@
+/**
+ * @file test_top_k.cpp
+ * @brief Unit tests for TopK: selection against a full sort, tie-breaking, capacity edge cases and merging.
+ */
+#include <cassert>
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <utility>
+#include <vector>
+#include "../include/top_k.h"
+#include "../include/avl_tree.h"
+
+/**
+ * @brief Reference selection: full sort by score desc, then key desc.
+ */
+static std::vector<uint32_t> bruteTopK(std::vector<std::pair<int, uint32_t>> c, std::size_t k) {
+    std::sort(c.begin(), c.end(), std::greater<std::pair<int, uint32_t>>());
+    std::vector<uint32_t> out;
+    for (std::size_t i = 0; i < c.size() && i < k; ++i) out.push_back(c[i].second);
+    return out;
+}
+
+/**
+ * @brief Executes tests for the TopK selector.
+ * @return 0 on success.
+ */
+int main() {
+    std::mt19937 rng(7);
+
+    // -------- Igual que ordenar todo (capacidad en línea y en el heap) --------
+    for (std::size_t k : {1, 5, 16, 17, 100}) {
+        std::vector<std::pair<int, uint32_t>> cand;
+        for (uint32_t key = 0; key < 3000; ++key) cand.emplace_back(static_cast<int>(rng() % 50), key);
+        std::shuffle(cand.begin(), cand.end(), rng);
+        TopK<int> best(k);
+        for (const auto& c : cand) best.offer(c.first, c.second);
+        assert(best.size() == k && best.full());
+        assert(best.keys() == bruteTopK(cand, k));
+        assert(best.worst().score == best.sorted().back().score);
+    }
+
+    // -------- Mismo orden que AVLTree::topK (desempate por mayor ID) --------
+    {
+        AVLTree tree;
+        TopK<int> best(8);
+        for (int u = 0; u < 500; ++u) {
+            int score = static_cast<int>(rng() % 10);
+            tree.insert(u, score);
+            best.offer(score, static_cast<uint32_t>(u));
+        }
+        std::vector<int> avl = tree.topK(8);
+        std::vector<uint32_t> sel = best.keys();
+        assert(std::equal(avl.begin(), avl.end(), sel.begin(), sel.end(),
+                          [](int a, uint32_t b) { return static_cast<uint32_t>(a) == b; }));
+    }
+
+    // -------- Desempate configurable y puntajes en coma flotante --------
+    {
+        TopK<double, int, std::less<int>> best(2);
+        best.offer(1.5, 9);
+        best.offer(1.5, 3);
+        best.offer(1.5, 5);
+        assert(!best.offer(0.5, 1));
+        std::vector<int> keys = best.keys();
+        assert(keys.size() == 2 && keys[0] == 3 && keys[1] == 5);
+    }
+
+    // -------- Casos límite --------
+    {
+        TopK<int> none(0);
+        assert(!none.offer(100, 1) && none.size() == 0 && none.keys().empty());
+        TopK<int> few(10);
+        few.offer(3, 1);
+        few.offer(7, 2);
+        assert(few.size() == 2 && !few.full());
+        assert(few.keys() == std::vector<uint32_t>({2, 1}));
+        few.clear();
+        assert(few.size() == 0 && few.capacity() == 10);
+    }
+    {
+        // Un k enorme no reserva nada por adelantado: crece con las entradas
+        TopK<int> huge(std::size_t(1) << 40);
+        for (uint32_t key = 0; key < 100; ++key) huge.offer(static_cast<int>(key % 7), key);
+        assert(huge.size() == 100 && !huge.full());
+        assert(huge.keys().front() == 97 && huge.keys().back() == 0);
+        huge.clear();
+        huge.offer(1, 5);
+        assert(huge.keys() == std::vector<uint32_t>({5}));
+    }
+
+    // -------- Fusión de resultados parciales (p. ej. uno por hilo) --------
+    {
+        std::vector<std::pair<int, uint32_t>> cand;
+        for (uint32_t key = 0; key < 10000; ++key) cand.emplace_back(static_cast<int>(rng() % 1000), key);
+        std::vector<TopK<int>> parts(4, TopK<int>(20));
+        for (std::size_t i = 0; i < cand.size(); ++i) parts[i % 4].offer(cand[i].first, cand[i].second);
+        TopK<int> all(20);
+        for (const TopK<int>& p : parts) all.merge(p);
+        assert(all.keys() == bruteTopK(cand, 20));
+
+        TopK<int> moved(std::move(parts[0]));           // la copia/movimiento reubica el almacenamiento
+        TopK<int> copy = moved;
+        assert(copy.keys() == moved.keys() && copy.size() == 20);
+    }
+    return 0;
+}